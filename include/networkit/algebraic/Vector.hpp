@@ -13,6 +13,7 @@
 #include <iostream>
 #include <numeric>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <networkit/Globals.hpp>
@@ -243,6 +244,37 @@ public:
      */
     Vector &operator-=(double value);
 
+    /**
+     * Sets this vector to @a other minus this vector.
+     * Note that the dimensions of the vectors have to be the same.
+     * @return Reference to this vector.
+     */
+    Vector &subtractFrom(const Vector &other);
+
+    /**
+     * Adds @a alpha times @a other to this vector in a single pass and without temporaries
+     * (y = alpha * x + y).
+     * Note that the dimensions of the vectors have to be the same.
+     * @return Reference to this vector.
+     */
+    Vector &addScaled(double alpha, const Vector &other);
+
+    /**
+     * Multiplies this vector with @a alpha and adds @a other in a single pass and without
+     * temporaries (y = alpha * y + x).
+     * Note that the dimensions of the vectors have to be the same.
+     * @return Reference to this vector.
+     */
+    Vector &scaleAndAdd(double alpha, const Vector &other);
+
+    /**
+     * Adds @a alpha times @a other to this vector and returns the squared length of the updated
+     * vector. Both are computed in a single pass.
+     * Note that the dimensions of the vectors have to be the same.
+     * @return The squared length of this vector after the update.
+     */
+    double addScaledAndSquaredLength(double alpha, const Vector &other);
+
     /**
      * Applies the unary function @a unaryElementFunction to each value in the Vector. Note that it
      * must hold that the function applied to the zero element of this matrix returns the zero
@@ -286,6 +318,54 @@ inline Vector operator*(double scalar, const Vector &v) {
     return v.operator*(scalar);
 }
 
+// The following overloads reuse the storage of temporary operands, so that expressions like
+// b - A * x do not allocate a second vector.
+
+inline Vector operator*(Vector &&v, double scalar) {
+    v *= scalar;
+    return std::move(v);
+}
+
+inline Vector operator*(double scalar, Vector &&v) {
+    v *= scalar;
+    return std::move(v);
+}
+
+inline Vector operator/(Vector &&v, double divisor) {
+    v /= divisor;
+    return std::move(v);
+}
+
+inline Vector operator+(Vector &&v1, const Vector &v2) {
+    v1 += v2;
+    return std::move(v1);
+}
+
+inline Vector operator+(const Vector &v1, Vector &&v2) {
+    v2 += v1;
+    return std::move(v2);
+}
+
+inline Vector operator+(Vector &&v1, Vector &&v2) {
+    v1 += v2;
+    return std::move(v1);
+}
+
+inline Vector operator-(Vector &&v1, const Vector &v2) {
+    v1 -= v2;
+    return std::move(v1);
+}
+
+inline Vector operator-(const Vector &v1, Vector &&v2) {
+    v2.subtractFrom(v1);
+    return std::move(v2);
+}
+
+inline Vector operator-(Vector &&v1, Vector &&v2) {
+    v1 -= v2;
+    return std::move(v1);
+}
+
 template <class Matrix>
 Matrix Vector::outerProduct(const Vector &v1, const Vector &v2) {
     std::vector<Triplet> triplets;
@@ -0,0 +1,102 @@
+/*
+ * HashAccumulator.hpp
+ *
+ * Open-addressing hash table that sums up values by integer key.
+ */
+
+#ifndef NETWORKIT_AUXILIARY_HASH_ACCUMULATOR_HPP_
+#define NETWORKIT_AUXILIARY_HASH_ACCUMULATOR_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+
+namespace NetworKit {
+
+/**
+ * Sums up values by integer key in an open-addressing hash table with linear probing.
+ *
+ * In contrast to SparseVector, the space does not depend on the largest key but on the number
+ * of distinct keys, which is bounded when calling reset(). This keeps the table small enough to
+ * stay in cache when many small sums over a large key range are computed one after another, e.g.
+ * the edge weight from a node to each of its neighboring communities. The memory is reused
+ * between resets, and a reset only clears the slots that have been used.
+ */
+template <typename T>
+class HashAccumulator {
+public:
+    /**
+     * Removes all entries and prepares the table for at most @a maxKeys distinct keys.
+     */
+    void reset(count maxKeys) {
+        for (const index slot : usedSlots)
+            keys[slot] = none;
+        usedSlots.clear();
+
+        count logCapacity = 4;
+        while ((count{1} << logCapacity) < 2 * maxKeys)
+            ++logCapacity;
+        if (keys.size() < (count{1} << logCapacity)) {
+            keys.assign(count{1} << logCapacity, none);
+            values.resize(keys.size());
+        }
+        shift = 64 - logCapacity;
+    }
+
+    /**
+     * Adds @a value to the sum of @a key.
+     */
+    void add(index key, T value) {
+        index slot = slotOf(key);
+        while (keys[slot] != key) {
+            if (keys[slot] == none) {
+                keys[slot] = key;
+                values[slot] = T{};
+                usedSlots.push_back(slot);
+                break;
+            }
+            slot = nextSlot(slot);
+        }
+        values[slot] += value;
+    }
+
+    /**
+     * Returns the sum of @a key, or T{} if the key has not been added since the last reset.
+     */
+    T get(index key) const {
+        for (index slot = slotOf(key); keys[slot] != none; slot = nextSlot(slot))
+            if (keys[slot] == key)
+                return values[slot];
+        return T{};
+    }
+
+    /**
+     * Returns the number of distinct keys added since the last reset.
+     */
+    count size() const { return usedSlots.size(); }
+
+    /**
+     * Calls @a handle(key, sum) for every key in the order in which the keys were first added.
+     */
+    template <typename L>
+    void forEntries(L &&handle) const {
+        for (const index slot : usedSlots)
+            handle(keys[slot], values[slot]);
+    }
+
+private:
+    std::vector<index> keys;
+    std::vector<T> values;
+    std::vector<index> usedSlots;
+    count shift = 64;
+
+    // Fibonacci hashing, the capacity is 2^(64 - shift)
+    index slotOf(index key) const { return (uint64_t{key} * 0x9E3779B97F4A7C15ULL) >> shift; }
+
+    index nextSlot(index slot) const { return (slot + 1) & ((index{1} << (64 - shift)) - 1); }
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_AUXILIARY_HASH_ACCUMULATOR_HPP_
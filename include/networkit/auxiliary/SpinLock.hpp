@@ -12,6 +12,7 @@ public:
             /* spin */
         }
     }
+    bool try_lock() { return !spinner.test_and_set(std::memory_order_acquire); }
     void unlock() { spinner.clear(std::memory_order_release); }
 
 private:
@@ -17,6 +17,7 @@ namespace NetworKit {
  * Approximation of betweenness centrality according to algorithm described in
  * Matteo Riondato and Evgenios M. Kornaropoulos: Fast Approximation of Betweenness Centrality
  * through Sampling
+ * On unweighted graphs, the paths are sampled with the bidirectional BFS of PathSamplingEngine.
  */
 class ApproxBetweenness final : public Centrality {
 
@@ -50,10 +51,16 @@ public:
      */
     count numberOfSamples() const;
 
+    /**
+     * @return number of path samples drawn per second in last run
+     */
+    double samplesPerSecond() const;
+
 private:
     const double epsilon;
     const double delta;
     count r; // number of samples taken in last run
+    double throughput;
     double universalConstant;
 };
 
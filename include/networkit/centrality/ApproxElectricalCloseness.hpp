@@ -65,7 +65,7 @@ public:
     /**
      * Compute and return the nearly-exact values of the diagonal of the laplacian's pseudoinverse.
      * The values are computed by solving Lx = e_u - 1 / n for every vertex u of the graph with a
-     * LAMG solver.
+     * LAMG solver, which solves the systems of several vertices at once.
      *
      * @param tol Tolerance for the LAMG solver.
      *
@@ -30,6 +30,34 @@ public:
      */
     Betweenness(const Graph &G, bool normalized = false, bool computeEdgeCentrality = false);
 
+    /**
+     * Limits the number of single-source searches that run concurrently. Each concurrent search
+     * owns an SSSP object and an O(n) dependency array, while the node scores are shared by all
+     * searches; this bounds the memory footprint of run() independently of the number of
+     * threads. Set to 0 (default) to use one search per thread.
+     *
+     * @param sources Maximum number of concurrent single-source searches.
+     */
+    void setMaxConcurrentSources(count sources) { maxConcurrentSources = sources; }
+
+    /**
+     * If set to <code>true</code>, the per-source dependencies are accumulated in single
+     * precision; this halves the size of the per-search accumulators at the cost of accuracy.
+     * The final scores are always summed up in double precision. Default: <code>false</code>.
+     */
+    void setSinglePrecisionDependencies(bool singlePrecision) {
+        singlePrecisionDependencies = singlePrecision;
+    }
+
+    /**
+     * If set to <code>true</code>, the sources are processed one after another and each BFS is
+     * parallelized level by level instead. This needs only a single set of O(n) accumulators
+     * and is intended for very large graphs where even a few concurrent searches do not fit
+     * into memory. Only supported for unweighted graphs; weighted graphs fall back to the
+     * source-parallel algorithm. Default: <code>false</code>.
+     */
+    void setParallelTraversal(bool parallel) { parallelTraversal = parallel; }
+
     /**
      * Computes betweenness scores on the graph passed in constructor.
      */
@@ -40,6 +68,16 @@ public:
      * nodes (=a star)
      */
     double maximum() override;
+
+private:
+    count maxConcurrentSources = 0;
+    bool singlePrecisionDependencies = false;
+    bool parallelTraversal = false;
+
+    template <typename Dependency>
+    void runSourceParallel();
+
+    void runParallelTraversal();
 };
 
 } /* namespace NetworKit */
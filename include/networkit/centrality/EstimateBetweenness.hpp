@@ -41,9 +41,15 @@ public:
      */
     void run() override;
 
+    /**
+     * @return number of sampled sources processed per second in last run
+     */
+    double samplesPerSecond() const;
+
 private:
     count nSamples;
     bool parallel_flag;
+    double throughput = 0;
 };
 
 } /* namespace NetworKit */
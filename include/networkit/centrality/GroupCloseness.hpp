@@ -12,6 +12,7 @@
 #include <sstream>
 
 #include <networkit/base/Algorithm.hpp>
+#include <networkit/centrality/LazyGreedy.hpp>
 #include <networkit/graph/BFS.hpp>
 #include <networkit/graph/Dijkstra.hpp>
 #include <networkit/graph/Graph.hpp>
@@ -63,12 +64,19 @@ public:
     double scoreOfGroup(const std::vector<node> &group) const;
 
 private:
-    edgeweight computeImprovement(node u, count h);
+    LazyGreedy::Evaluation computeImprovement(node u, count h, double threshold);
     void updateDistances(node u);
     const Graph *G;
     count k = 1;
     std::vector<count> d;
+    // Number of nodes at each distance from the group
+    std::vector<count> distCount;
+    // Thread-local distances after adding a node to the group; an entry is only valid if its
+    // timestamp matches the current timestamp of the thread, otherwise the distance in d applies.
     std::vector<std::vector<count>> d1Global;
+    std::vector<std::vector<count>> timestampGlobal;
+    std::vector<count> curTimestamp;
+    std::vector<std::vector<node>> queueGlobal;
     std::vector<node> S;
     count H = 0;
 
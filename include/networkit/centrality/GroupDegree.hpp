@@ -10,8 +10,8 @@
 
 #include <omp.h>
 
-#include <networkit/auxiliary/BucketPQ.hpp>
 #include <networkit/base/Algorithm.hpp>
+#include <networkit/centrality/LazyGreedy.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -69,16 +69,16 @@ protected:
     const bool countGroupNodes;
     count n;
     std::vector<node> group;
-    std::vector<int64_t> gain;
+    // Upper bounds of the marginal gains, exact for the nodes evaluated in the last round
+    std::vector<double> gain;
     std::vector<bool> reachable;
-    std::vector<bool> affected;
     std::vector<bool> inGroup;
-    Aux::BucketPQ queue;
+    LazyGreedy greedy;
     count groupScore;
 
     void init();
-    void updateQueue();
-    void updateGroup();
+    int64_t marginalGain(node u) const;
+    void updateGroup(node u);
     void computeScore();
     void checkGroup(const std::vector<node> &group) const;
 };
@@ -11,12 +11,11 @@
 
 #include <atomic>
 #include <memory>
-#include <random>
 #include <vector>
 
 #include <networkit/auxiliary/SortedList.hpp>
 #include <networkit/base/Algorithm.hpp>
-#include <networkit/components/ConnectedComponents.hpp>
+#include <networkit/centrality/ShortestPathSampler.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -47,34 +46,6 @@ public:
     std::vector<double> errU;
 };
 
-class SpSampler {
-private:
-    const Graph &G;
-    const ConnectedComponents &cc;
-
-public:
-    SpSampler(const Graph &G, const ConnectedComponents &cc);
-    void randomPath(StateFrame *curFrame);
-    StateFrame *frame;
-    std::mt19937_64 rng;
-    std::uniform_int_distribution<node> distr;
-
-private:
-    std::vector<uint8_t> timestamp;
-    uint8_t globalTS = 1;
-    static constexpr uint8_t stampMask = 0x7F;
-    static constexpr uint8_t ballMask = 0x80;
-    std::vector<count> dist;
-    std::vector<count> nPaths;
-    std::vector<node> q;
-    std::vector<std::pair<node, node>> spEdges;
-
-    inline node randomNode() const;
-    void backtrackPath(node source, node target, node start);
-    void resetSampler(count endQ);
-    count getDegree(const Graph &graph, node y, bool useDegreeIn);
-};
-
 /**
  * @ingroup centrality
  */
@@ -175,6 +146,14 @@ public:
         return omega;
     }
 
+    /**
+     * @return Number of samples drawn per second by the adaptive sampling phase.
+     */
+    double getSamplesPerSecond() const {
+        assureFinished();
+        return samplesPerSecond;
+    }
+
     count maxAllocatedFrames() const {
         assureFinished();
         return *std::max_element(maxFrames.begin(), maxFrames.end());
@@ -188,7 +167,7 @@ protected:
     count unionSample;
     count nPairs;
     const bool absolute;
-    double deltaLMinGuess, deltaUMinGuess, omega;
+    double deltaLMinGuess, deltaUMinGuess, omega, samplesPerSecond;
     std::atomic<int32_t> epochToRead;
     int32_t epochRead;
     count seed0, seed1;
@@ -198,9 +177,8 @@ protected:
     std::vector<double> topkScores;
     std::vector<std::pair<node, double>> rankingVector;
     std::vector<std::atomic<StateFrame *>> epochFinished;
-    std::vector<SpSampler> samplerVec;
+    std::unique_ptr<PathSamplingEngine> engine;
     std::unique_ptr<Aux::SortedList> top;
-    std::unique_ptr<ConnectedComponents> cc;
 
     std::vector<double> approxSum;
     std::vector<double> deltaLGuess;
@@ -0,0 +1,160 @@
+/*
+ * LazyGreedy.hpp
+ *
+ * Lazy greedy maximization shared by the group centrality algorithms.
+ */
+
+#ifndef NETWORKIT_CENTRALITY_LAZY_GREEDY_HPP_
+#define NETWORKIT_CENTRALITY_LAZY_GREEDY_HPP_
+
+#include <limits>
+#include <vector>
+#include <omp.h>
+
+#include <networkit/Globals.hpp>
+#include <networkit/auxiliary/VectorComparator.hpp>
+
+#include <tlx/container/d_ary_addressable_int_heap.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Lazy greedy (CELF) engine for the maximization of submodular group centralities. Candidates
+ * are kept in a max-heap keyed by an upper bound of their marginal gain. Since marginal gains
+ * can only decrease while the group grows, the gain of a node evaluated in an earlier round is
+ * still a valid bound, and each round only re-evaluates the nodes whose bound exceeds the best
+ * gain found so far. The evaluations of a round run in parallel; every thread extracts the
+ * candidate with the highest bound and evaluates it outside of the lock protecting the heap.
+ */
+class LazyGreedy final {
+public:
+    /**
+     * Result of the evaluation of a candidate.
+     */
+    struct Evaluation {
+        //! Marginal gain of the candidate, or an upper bound if the evaluation was pruned.
+        double gain;
+        //! Whether @a gain is exact.
+        bool exact;
+    };
+
+    /**
+     * @param bounds Upper bounds of the marginal gains, indexed by node. The engine replaces the
+     * bound of every evaluated node with the result of the evaluation.
+     */
+    LazyGreedy(std::vector<double> &bounds);
+
+    ~LazyGreedy();
+
+    LazyGreedy(const LazyGreedy &) = delete;
+    LazyGreedy &operator=(const LazyGreedy &) = delete;
+
+    /**
+     * Replaces the candidates with the nodes in [@a first, @a last). Must be called again after
+     * the bounds of the current candidates have been changed from outside the engine.
+     */
+    template <typename InputIt>
+    void setCandidates(InputIt first, InputIt last) {
+        heap.build_heap(first, last);
+    }
+
+    /**
+     * Removes @a u from the candidates, if it is one of them.
+     */
+    void removeCandidate(node u) {
+        if (heap.contains(u))
+            heap.remove(u);
+    }
+
+    /**
+     * Number of remaining candidates.
+     */
+    count numberOfCandidates() const noexcept { return heap.size(); }
+
+    /**
+     * Finds the candidate with the highest marginal gain and removes it from the candidates.
+     * @a evaluate(u, threshold) must return the marginal gain of u; it is called concurrently
+     * and may stop as soon as it can prove that the gain of u is not larger than threshold, in
+     * which case it returns an upper bound of the gain that is not exact. @a onImprove(u) is
+     * called by the thread that evaluated u whenever u becomes the best candidate of the round;
+     * the calls are serialized.
+     *
+     * @return The selected node, or none if there are no candidates.
+     */
+    template <typename Evaluate, typename OnImprove>
+    node selectNext(Evaluate &&evaluate, OnImprove &&onImprove);
+
+    template <typename Evaluate>
+    node selectNext(Evaluate &&evaluate) {
+        return selectNext(evaluate, [](node) {});
+    }
+
+    /**
+     * Returns the marginal gain of the node selected by the last call of selectNext().
+     */
+    double lastGain() const noexcept { return bestGain; }
+
+    /**
+     * Returns the number of evaluations in the last call of selectNext().
+     */
+    count numberOfEvaluations() const noexcept { return evaluated.size(); }
+
+private:
+    std::vector<double> *bounds;
+    tlx::d_ary_addressable_int_heap<node, 2, Aux::GreaterInVector<double>> heap;
+    std::vector<node> evaluated;
+    double bestGain = 0;
+    omp_lock_t lock;
+};
+
+template <typename Evaluate, typename OnImprove>
+node LazyGreedy::selectNext(Evaluate &&evaluate, OnImprove &&onImprove) {
+    node best = none;
+    double curBest = -std::numeric_limits<double>::max();
+    bool stop = false;
+    evaluated.clear();
+
+#pragma omp parallel
+    {
+        while (true) {
+            node u = none;
+            double threshold = 0;
+            omp_set_lock(&lock);
+            if (!stop && !heap.empty() && (best == none || (*bounds)[heap.top()] > curBest)) {
+                u = heap.extract_top();
+                evaluated.push_back(u);
+                threshold = curBest;
+            } else {
+                stop = true;
+            }
+            omp_unset_lock(&lock);
+
+            if (u == none)
+                break;
+
+            const Evaluation result = evaluate(u, threshold);
+
+            omp_set_lock(&lock);
+            (*bounds)[u] = result.gain;
+            if (result.exact && (best == none || result.gain > curBest)) {
+                best = u;
+                curBest = result.gain;
+                onImprove(u);
+            }
+            omp_unset_lock(&lock);
+        }
+    }
+
+    // All evaluated nodes except the selected one remain candidates with their new bounds.
+    for (const node u : evaluated)
+        if (u != best)
+            heap.push(u);
+
+    bestGain = curBest;
+    return best;
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CENTRALITY_LAZY_GREEDY_HPP_
@@ -0,0 +1,115 @@
+/*
+ * PowerIteration.hpp
+ *
+ * Power iteration kernel shared by the spectral centralities.
+ */
+
+#ifndef NETWORKIT_CENTRALITY_POWER_ITERATION_HPP_
+#define NETWORKIT_CENTRALITY_POWER_ITERATION_HPP_
+
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Pull-based sparse matrix-vector product for power iterations over the adjacency matrix of a
+ * graph. The constructor takes a CSR snapshot of the graph in which row u holds the
+ * in-neighbors (or out-neighbors) of u and the weights of the corresponding edges, so every
+ * iteration streams over contiguous memory and computes each entry of the result in a single
+ * thread without atomics. The norms needed for normalization and the convergence test are
+ * accumulated in the same pass.
+ */
+class PowerIteration final {
+public:
+    /**
+     * Result of a call of multiply().
+     */
+    struct Step {
+        //! Squared 2-norm of the result.
+        double squaredNorm = 0;
+        //! Squared 2-norm of the difference between the result and the input.
+        double squaredDiff = 0;
+        //! 1-norm of the difference between the result and the input.
+        double absDiff = 0;
+
+        double norm() const { return std::sqrt(squaredNorm); }
+        double l2Diff() const { return std::sqrt(squaredDiff); }
+        double l1Diff() const { return absDiff; }
+    };
+
+    /**
+     * @param G The graph.
+     * @param inEdges If <code>true</code>, entry u of a product sums over the in-edges of u,
+     * otherwise over the out-edges of u. Both are the same for undirected graphs.
+     */
+    PowerIteration(const Graph &G, bool inEdges = true);
+
+    /**
+     * Multiplies the weight of every stored edge by @a factor(v), where v is the neighbor the
+     * entry is pulled from.
+     */
+    template <typename F>
+    void scaleColumns(F &&factor);
+
+    /**
+     * Computes y[u] = @a transform(u, s) for every node u, where s is the sum of w * x[v] over
+     * the stored edges {u, v} with weight w. Entries of non-existing nodes are not modified.
+     */
+    template <typename Transform>
+    Step multiply(const std::vector<double> &x, std::vector<double> &y,
+                  Transform &&transform) const;
+
+private:
+    const Graph *G;
+    std::vector<index> offsets;
+    std::vector<node> neighbors;
+    std::vector<edgeweight> weights;
+};
+
+template <typename F>
+void PowerIteration::scaleColumns(F &&factor) {
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(neighbors.size()); ++i)
+        weights[i] *= factor(neighbors[i]);
+}
+
+template <typename Transform>
+PowerIteration::Step PowerIteration::multiply(const std::vector<double> &x,
+                                              std::vector<double> &y,
+                                              Transform &&transform) const {
+    assert(x.size() + 1 >= offsets.size() && y.size() + 1 >= offsets.size());
+    double squaredNorm = 0, squaredDiff = 0, absDiff = 0;
+
+#pragma omp parallel for schedule(guided) reduction(+ : squaredNorm, squaredDiff, absDiff)
+    for (omp_index i = 0; i < static_cast<omp_index>(offsets.size()) - 1; ++i) {
+        const node u = static_cast<node>(i);
+        if (!G->hasNode(u))
+            continue;
+
+        double sum = 0;
+        for (index j = offsets[u]; j < offsets[u + 1]; ++j)
+            sum += weights[j] * x[neighbors[j]];
+
+        const double value = transform(u, sum);
+        const double diff = value - x[u];
+        y[u] = value;
+        squaredNorm += value * value;
+        squaredDiff += diff * diff;
+        absDiff += std::abs(diff);
+    }
+
+    Step step;
+    step.squaredNorm = squaredNorm;
+    step.squaredDiff = squaredDiff;
+    step.absDiff = absDiff;
+    return step;
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CENTRALITY_POWER_ITERATION_HPP_
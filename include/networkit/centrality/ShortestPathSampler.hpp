@@ -0,0 +1,172 @@
+/*
+ * ShortestPathSampler.hpp
+ *
+ * Shortest path sampling shared by the sampling-based betweenness approximations.
+ */
+
+#ifndef NETWORKIT_CENTRALITY_SHORTEST_PATH_SAMPLER_HPP_
+#define NETWORKIT_CENTRALITY_SHORTEST_PATH_SAMPLER_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include <omp.h>
+
+#include <networkit/auxiliary/Timer.hpp>
+#include <networkit/components/ConnectedComponents.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Samples a shortest path between two nodes uniformly at random using a balanced bidirectional
+ * BFS: in every step, the search whose frontier has the smaller sum of degrees is expanded by
+ * one level. The search from the source follows out-edges, the search from the target follows
+ * in-edges. Edge weights are ignored.
+ */
+class ShortestPathSampler {
+public:
+    /**
+     * @param G The graph.
+     * @param cc Optional connected components of @a G (undirected graphs only), used to skip
+     * pairs of nodes that are not connected without running a search.
+     */
+    ShortestPathSampler(const Graph &G, const ConnectedComponents *cc = nullptr);
+
+    /**
+     * Seeds the random number generator of the sampler.
+     */
+    void seed(uint64_t seed) { rng.seed(seed); }
+
+    /**
+     * Samples a pair of distinct nodes uniformly at random and a shortest path between them
+     * uniformly at random. For every inner node x of the path, @a counts[x] is incremented.
+     *
+     * @return <code>true</code> if the target is reachable from the source.
+     */
+    bool randomPath(std::vector<count> &counts);
+
+    /**
+     * Like randomPath(std::vector<count> &), but for a fixed pair of nodes.
+     */
+    bool randomPath(node source, node target, std::vector<count> &counts);
+
+private:
+    const Graph *G;
+    const ConnectedComponents *cc;
+    std::mt19937_64 rng;
+    std::uniform_int_distribution<node> distr;
+
+    // The lower 7 bits store the timestamp of the search, the highest bit is set for nodes that
+    // were reached by the search from the target.
+    std::vector<uint8_t> timestamp;
+    uint8_t globalTS = 1;
+    static constexpr uint8_t stampMask = 0x7F;
+    static constexpr uint8_t ballMask = 0x80;
+    std::vector<count> dist;
+    std::vector<count> nPaths;
+    std::vector<node> q;
+    std::vector<std::pair<node, node>> spEdges;
+
+    void backtrackPath(node start, std::vector<count> &counts);
+    void resetSampler(count endQ);
+};
+
+/**
+ * @ingroup centrality
+ * Parallel driver for sampling-based betweenness approximations. Every thread owns a
+ * ShortestPathSampler and a local buffer for its results; the buffers are merged once all
+ * samples of a run have been drawn, so no atomic updates of shared scores are needed. The
+ * engine keeps track of the sampling throughput of the last run.
+ */
+class PathSamplingEngine {
+public:
+    /**
+     * @param G The graph.
+     * @param parallel If <code>false</code>, all samples are drawn by the calling thread.
+     */
+    PathSamplingEngine(const Graph &G, bool parallel = true);
+
+    /**
+     * Draws @a samples shortest paths between pairs of distinct nodes chosen uniformly at
+     * random, see ShortestPathSampler::randomPath.
+     *
+     * @param samples The number of samples.
+     * @param seed Seed for the random number generators of the samplers.
+     * @return For every node, the number of sampled paths that contain it as an inner node.
+     */
+    std::vector<count> samplePaths(count samples, uint64_t seed);
+
+    /**
+     * Calls @a sample(i, scores) for every sample i in [0, @a samples) in parallel. @a scores is
+     * a thread-local buffer with one entry per node, all buffers are added to @a result.
+     */
+    template <typename Sample>
+    void run(count samples, std::vector<double> &result, Sample &&sample);
+
+    /**
+     * Creates one ShortestPathSampler per thread, unless this has already been done. Only needed
+     * before getSampler(), samplePaths() calls it implicitly.
+     */
+    void initSamplers();
+
+    /**
+     * @return The sampler owned by thread @a thread.
+     */
+    ShortestPathSampler &getSampler(index thread) {
+        assert(thread < samplers.size());
+        return samplers[thread];
+    }
+
+    /**
+     * @return Number of threads used by the engine.
+     */
+    count numberOfThreads() const { return threads; }
+
+    /**
+     * @return Number of samples drawn per second in the last run.
+     */
+    double samplesPerSecond() const { return throughput; }
+
+private:
+    const Graph *G;
+    const count threads;
+    std::unique_ptr<ConnectedComponents> cc;
+    std::vector<ShortestPathSampler> samplers;
+    double throughput = 0;
+
+    void recordThroughput(count samples, const Aux::Timer &timer);
+};
+
+template <typename Sample>
+void PathSamplingEngine::run(count samples, std::vector<double> &result, Sample &&sample) {
+    const count n = G->upperNodeIdBound();
+    std::vector<std::vector<double>> localScores(threads);
+
+    Aux::Timer timer;
+    timer.start();
+#pragma omp parallel num_threads(threads)
+    {
+        auto &scores = localScores[omp_get_thread_num()];
+        scores.resize(n);
+#pragma omp for schedule(dynamic, 16)
+        for (omp_index i = 0; i < static_cast<omp_index>(samples); ++i)
+            sample(static_cast<index>(i), scores);
+    }
+    timer.stop();
+    recordThroughput(samples, timer);
+
+    result.resize(n);
+#pragma omp parallel for
+    for (omp_index v = 0; v < static_cast<omp_index>(n); ++v)
+        for (const auto &scores : localScores)
+            if (!scores.empty())
+                result[v] += scores[v];
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CENTRALITY_SHORTEST_PATH_SAMPLER_HPP_
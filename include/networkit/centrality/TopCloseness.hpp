@@ -16,6 +16,8 @@
 
 namespace NetworKit {
 
+class MultiSourceBFS;
+
 /**
  * @ingroup centrality
  */
@@ -82,11 +84,22 @@ public:
         nodeListPtr = &nodeList;
     };
 
+    /**
+     * If set to <code>true</code>, the candidates are analyzed in batches of 64 nodes that
+     * share one bit-parallel multi-source BFS; a BFS is cut as soon as the lower bound on the
+     * farness of its source exceeds the current k-th farness. The batches are processed one
+     * after another and the BFS runs in parallel, which scales better than analyzing one
+     * candidate per thread on large graphs. Replaces BFScut and BFSbound, i.e., @a sec_heu is
+     * ignored. Default: <code>false</code>.
+     */
+    void setBatchedBFS(bool batched) { batchedBFS = batched; }
+
 private:
     const Graph &G;
     count n;
     count k;
     bool first_heu, sec_heu;
+    bool batchedBFS = false;
     std::vector<node> topk;
     const std::vector<node> *nodeListPtr;
     count visEdges;
@@ -108,6 +121,8 @@ private:
     void BFSbound(node x, std::vector<double> &S, count &visEdges,
                   const std::vector<bool> &toAnalyze);
     void computeReachable();
+    void batchBFScut(const std::vector<node> &batch, double x, MultiSourceBFS &msbfs,
+                     count &visEdges);
 };
 
 inline std::vector<node> TopCloseness::topkNodesList(bool includeTrail) {
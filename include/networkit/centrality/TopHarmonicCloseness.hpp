@@ -19,6 +19,8 @@
 
 namespace NetworKit {
 
+class MultiSourceBFS;
+
 /**
  * @ingroup centrality
  */
@@ -87,10 +89,20 @@ public:
         nodeListPtr = &nodeList;
     };
 
+    /**
+     * If set to <code>true</code>, the NBcut variation analyzes the candidates of unweighted
+     * graphs in batches of 64 nodes that share one bit-parallel multi-source BFS; a BFS is cut as
+     * soon as the upper bound on the harmonic closeness of its source drops below the current
+     * k-th harmonic closeness. The batches are processed one after another and the BFS runs in
+     * parallel. Default: <code>false</code>.
+     */
+    void setBatchedBFS(bool batched) { batchedBFS = batched; }
+
 private:
     const Graph *G;
     const count k;
     const bool useNBbound;
+    bool batchedBFS = false;
 
     std::vector<double> hCloseness;
     std::vector<count> reachableNodes;
@@ -132,8 +144,11 @@ private:
     void init();
     void runNBcut();
     void runNBbound();
+    void runNBcutBatched();
     bool bfscutUnweighted(node source, double kthCloseness);
     bool bfscutWeighted(node source, double kthCloseness);
+    uint64_t bfscutBatch(const std::vector<node> &batch, double kthCloseness,
+                         MultiSourceBFS &msbfs);
     void bfsbound(node source);
     void computeReachableNodes();
     void computeReachableNodesBounds();
@@ -16,6 +16,14 @@ namespace NetworKit {
 
 /**
  * @ingroup coarsening
+ * Contracts each subset of a partition into a single node. The edges between the nodes of a
+ * subset become a self-loop, and parallel edges between two subsets are merged by summing up
+ * their weights.
+ *
+ * The fine nodes are grouped by subset with a counting sort, and the edge weights of each subset
+ * are summed up in a hash table that only depends on the degrees of its nodes, so the running
+ * time is linear in the size of the graph and independent of the number of subsets. If
+ * @a parallel is true, the order of the neighbors of a coarse node may depend on the scheduling.
  */
 class ParallelPartitionCoarsening final : public GraphCoarsening {
 public:
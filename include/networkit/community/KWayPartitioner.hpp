@@ -0,0 +1,97 @@
+/*
+ * KWayPartitioner.hpp
+ *
+ * Multilevel balanced k-way graph partitioning.
+ */
+
+#ifndef NETWORKIT_COMMUNITY_K_WAY_PARTITIONER_HPP_
+#define NETWORKIT_COMMUNITY_K_WAY_PARTITIONER_HPP_
+
+#include <vector>
+
+#include <networkit/community/CommunityDetectionAlgorithm.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Multilevel partitioner that divides the nodes of an undirected graph into k blocks of
+ * (almost) equal size while keeping the weight of the cut edges small.
+ *
+ * The graph is coarsened by contracting clusters found by size-constrained label propagation
+ * (ParallelPartitionCoarsening) until it has only a few nodes per block. The coarsest graph is
+ * partitioned several times by cutting BFS orders from random start nodes into pieces, and the
+ * partition with the smallest cut is kept. The partition is then projected back level by level
+ * and refined on every level by parallel label propagation: a node moves to the adjacent block
+ * it is connected to most strongly, as long as the target block stays within the balance
+ * constraint. Nodes of overloaded blocks may also move if this worsens the cut.
+ *
+ * The weight of a block is its number of nodes. The balance constraint allows at most
+ * (1 + epsilon) * ceil(n / k) nodes per block, but it is only enforced on a best-effort basis.
+ * The nodes of the coarsest graph have indivisible weights, so it may not be partitionable that
+ * finely, and the greedy initial partitioning cuts the BFS order by weight without checking the
+ * bound. Refinement never moves a node into a block without room for it, but it cannot always
+ * empty an overloaded block, e.g. if its nodes have no neighbors in blocks with room.
+ * getImbalance() reports the achieved balance.
+ */
+class KWayPartitioner final : public CommunityDetectionAlgorithm {
+public:
+    /**
+     * @param G The undirected input graph.
+     * @param k The number of blocks.
+     * @param epsilon The allowed imbalance of the blocks.
+     * @param maxRefinementIterations Maximum number of label propagation rounds per level.
+     */
+    KWayPartitioner(const Graph &G, count k, double epsilon = 0.03,
+                    count maxRefinementIterations = 16);
+
+    void run() override;
+
+    /**
+     * Returns the total weight of the edges whose endpoints are in different blocks.
+     */
+    edgeweight getEdgeCut() const {
+        assureFinished();
+        return edgeCut;
+    }
+
+    /**
+     * Returns the communication volume, i.e., the sum over all nodes of the number of other
+     * blocks that contain a neighbor of the node.
+     */
+    count getCommunicationVolume() const {
+        assureFinished();
+        return communicationVolume;
+    }
+
+    /**
+     * Returns the size of the largest block divided by ceil(n / k), minus 1.
+     */
+    double getImbalance() const {
+        assureFinished();
+        return imbalance;
+    }
+
+private:
+    const count k;
+    const double epsilon;
+    const count maxRefinementIterations;
+
+    edgeweight edgeCut = 0;
+    count communicationVolume = 0;
+    double imbalance = 0;
+
+    // Assigns the nodes of the coarsest graph to blocks along a BFS order from @a start.
+    std::vector<index> initialPartition(const Graph &coarsest,
+                                        const std::vector<double> &nodeWeights, node start) const;
+
+    // Improves the cut of @a blocks by size-constrained label propagation.
+    void refine(const Graph &graph, const std::vector<double> &nodeWeights,
+                std::vector<index> &blocks, double maxBlockWeight) const;
+
+    void computeMetrics();
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_K_WAY_PARTITIONER_HPP_
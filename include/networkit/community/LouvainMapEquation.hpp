@@ -33,7 +33,7 @@ private:
      * @param[in] maxIterations maximum number of iterations for move phase
      * @param[in] parallelization strategy (default synchronous):
      *            none
-     *            relaxmap    -> one lock per community to update cuts
+     *            relaxmap    -> lock the two communities of a move to update cuts
      *            synchronous -> work on stale cuts and volumes, update in second step
      *
      */
@@ -47,7 +47,7 @@ public:
      * @param[in] maxIterations maximum number of iterations for move phase
      * @param[in] parallelization strategy (default synchronous):
      *            none
-     *            relaxmap    -> one lock per community to update cuts
+     *            relaxmap    -> lock the two communities of a move to update cuts
      *            synchronous -> work on stale cuts and volumes, update in second step
      *
      */
@@ -83,13 +83,26 @@ private:
     std::vector<double> clusterCut, clusterVolume;
     double totalCut, totalVolume;
 
-    // for RelaxMap
+    // for RelaxMap: communities are mapped to a fixed number of locks
+    static constexpr count maxNumberOfLocks = count{1} << 16;
     std::vector<Aux::Spinlock> locks;
 
+    index lockIndex(index cluster) const { return cluster % locks.size(); }
+
     // for SLM
     Partition nextPartition;
     std::vector<SparseVector<double>> ets_neighborClusterWeights;
 
+    struct ClusterUpdate {
+        index cluster;
+        double cut, volume;
+    };
+
+    // ets_clusterUpdates[t][s] holds the updates found by thread t for the clusters owned by
+    // thread s; every thread applies the updates of its own clusters, so no atomics are needed
+    std::vector<std::vector<std::vector<ClusterUpdate>>> ets_clusterUpdates;
+    std::vector<double> ets_totalCutUpdate;
+
     count localMoving(std::vector<node> &nodes, count iteration);
 
     count synchronousLocalMoving(std::vector<node> &nodes, count iteration);
@@ -100,7 +113,10 @@ private:
     bool performMove(node u, double degree, double loopWeight, node currentCluster,
                      node targetCluster, double weightToTarget, double weightToCurrent);
 
-    void aggregateAndApplyCutAndVolumeUpdates(std::vector<Move> &moves);
+    void collectCutAndVolumeUpdates(const std::vector<Move> &moves, index thread,
+                                    count numThreads);
+
+    void applyCutAndVolumeUpdates(index thread, count numThreads);
 
     void calculateInitialClusterCutAndVolume();
 
@@ -8,8 +8,12 @@
 #ifndef NETWORKIT_COMMUNITY_OVERLAPPING_COMMUNITY_DETECTION_ALGORITHM_HPP_
 #define NETWORKIT_COMMUNITY_OVERLAPPING_COMMUNITY_DETECTION_ALGORITHM_HPP_
 
+#include <memory>
+#include <mutex>
+
 #include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
+#include <networkit/structures/CompactCover.hpp>
 #include <networkit/structures/Cover.hpp>
 
 namespace NetworKit {
@@ -17,6 +21,10 @@ namespace NetworKit {
 /**
  * @ingroup community
  * Abstract base class for overlapping community detection/graph clustering algorithms.
+ *
+ * Derived classes store their result with setResult(), either as a Cover or as a CompactCover.
+ * The other representation is only built on the first call of getCover() or getCompactCover(),
+ * and is discarded whenever a new result is stored.
  */
 class OverlappingCommunityDetectionAlgorithm : public Algorithm {
 public:
@@ -42,9 +50,32 @@ public:
      */
     const Cover &getCover() const;
 
+    /**
+     * Returns the result of the run method as a CompactCover or throws an error, if the algorithm
+     * hasn't run yet.
+     * @return cover of the node set
+     */
+    const CompactCover &getCompactCover() const;
+
 protected:
     const Graph *G;
-    Cover result;
+
+    /**
+     * Stores the result of the run method.
+     */
+    void setResult(Cover cover);
+
+    /**
+     * Stores the result of the run method.
+     */
+    void setResult(CompactCover cover);
+
+private:
+    mutable Cover result;
+    mutable CompactCover compactResult;
+    bool compactIsResult = false; //!< whether result is derived from compactResult or vice versa
+    //! guards the lazy conversion between result and compactResult
+    std::unique_ptr<std::once_flag> conversion = std::make_unique<std::once_flag>();
 };
 
 } /* namespace NetworKit */
@@ -29,7 +29,8 @@ public:
      *            2m -> singleton communities
      * @param[in] maxIter maximum number of iterations for move phase
      * @param[in] parallelCoarsening use parallel graph coarsening
-     * @param[in] turbo faster but uses O(n) additional memory per thread
+     * @param[in] turbo faster but uses O(n) additional memory per thread; otherwise the
+     * additional memory per thread is linear in the maximum degree
      * @param[in] recurse use recursive coarsening, see
      * http://journals.aps.org/pre/abstract/10.1103/PhysRevE.89.049902 for some explanations
      * (default: true)
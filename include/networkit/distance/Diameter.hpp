@@ -61,8 +61,12 @@ private:
     std::pair<edgeweight, edgeweight> estimatedDiameterRange(const Graph &G, double error);
 
     /**
-     * Get the exact diameter of the graph @a G. The algorithm for unweighted graphs is the same as
-     * the algorithm for the estimated diameter range with error 0.
+     * Get the exact diameter of the graph @a G. The algorithm maintains lower and upper bounds on
+     * the (forward and backward) eccentricities of all nodes in the spirit of iFUB/DiFUB and
+     * computes the eccentricities of batches of nodes concurrently until the bounds prove the
+     * diameter. Works for directed and undirected, weighted and unweighted graphs. For unweighted
+     * undirected graphs, the maximum diameter of all connected components is returned; otherwise
+     * the graph must be (strongly) connected.
      *
      * @param G The graph.
      * @return exact diameter of the graph @a G
@@ -0,0 +1,106 @@
+/*
+ * MultiSourceBFS.hpp
+ */
+
+#ifndef NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
+#define NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include <omp.h>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Bit-parallel BFS from up to 64 sources at once in unweighted graphs. Every node stores one bit
+ * per source in a 64-bit word, so a single pass over the graph advances all searches by one
+ * level. Large frontiers are expanded bottom-up by pulling the frontier bits from the
+ * in-neighbors of every node, which runs in parallel without atomics. Frontiers whose
+ * out-degrees sum up to less than a 1/pushFactor fraction of all arcs are expanded top-down by
+ * pushing their bits to their out-neighbors instead, so that the first and last levels do not
+ * scan the whole graph. Edge weights are ignored.
+ */
+class MultiSourceBFS final {
+public:
+    using Mask = uint64_t;
+    static constexpr count maxSources = 64;
+    static constexpr count pushFactor = 14;
+
+    MultiSourceBFS(const Graph &G);
+
+    /**
+     * Runs the BFS from all @a sources (at most maxSources). After level d >= 1 has been
+     * discovered, @a handleLevel(d, found) is called, where found[i] is the number of nodes at
+     * distance d from sources[i]. If found[i] is zero for a search that is still running, the
+     * search from sources[i] is complete. The callback returns a mask of searches that must not
+     * be continued; bit i refers to sources[i].
+     */
+    template <typename L>
+    void run(const std::vector<node> &sources, L &&handleLevel);
+
+private:
+    using LevelCounts = std::array<count, maxSources>;
+
+    const Graph *G;
+    std::vector<Mask> seen, frontier, next;
+    // Nodes with a non-zero entry in frontier and next, respectively.
+    std::vector<node> frontierNodes, nextNodes;
+
+    void pushLevel(Mask active, LevelCounts &found);
+    void pullLevel(Mask active, LevelCounts &found);
+};
+
+template <typename L>
+void MultiSourceBFS::run(const std::vector<node> &sources, L &&handleLevel) {
+    assert(sources.size() <= maxSources);
+    const count arcs = G->isDirected() ? G->numberOfEdges() : 2 * G->numberOfEdges();
+    std::fill(seen.begin(), seen.end(), 0);
+    std::fill(frontier.begin(), frontier.end(), 0);
+    std::fill(next.begin(), next.end(), 0);
+    frontierNodes.clear();
+
+    Mask active = 0;
+    for (index i = 0; i < sources.size(); ++i) {
+        const Mask bit = Mask{1} << i;
+        if (!frontier[sources[i]])
+            frontierNodes.push_back(sources[i]);
+        seen[sources[i]] |= bit;
+        frontier[sources[i]] |= bit;
+        active |= bit;
+    }
+
+    for (count level = 1; active; ++level) {
+        count frontierArcs = 0;
+#pragma omp parallel for reduction(+ : frontierArcs)
+        for (omp_index i = 0; i < static_cast<omp_index>(frontierNodes.size()); ++i)
+            frontierArcs += G->degreeOut(frontierNodes[i]);
+
+        LevelCounts found{};
+        nextNodes.clear();
+        if (frontierArcs * pushFactor < arcs)
+            pushLevel(active, found);
+        else
+            pullLevel(active, found);
+
+        // Reset the old frontier, so that next is all zero at the start of the next level.
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(frontierNodes.size()); ++i)
+            frontier[frontierNodes[i]] = 0;
+        std::swap(frontier, next);
+        std::swap(frontierNodes, nextNodes);
+
+        active &= ~static_cast<Mask>(handleLevel(level, found));
+        for (index j = 0; j < sources.size(); ++j)
+            if (!found[j])
+                active &= ~(Mask{1} << j);
+    }
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
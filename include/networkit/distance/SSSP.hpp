@@ -119,6 +119,16 @@ public:
      */
     const std::vector<node> &getNodesSortedByDistance() const;
 
+    /**
+     * Returns the nodes whose distance from the source was set by the last run, i.e., all nodes
+     * reached by the search and, if the search stopped at the target, the nodes discovered but
+     * not yet visited. The entries of all other nodes in getDistances() are infinite, so this is
+     * a sparse representation of the result of a local search. Only recorded by BFS and Dijkstra.
+     *
+     * @return Nodes touched by the last run.
+     */
+    const std::vector<node> &getTouchedNodes() const;
+
     /**
      * Returns the number of nodes reached by the source.
      *
@@ -170,11 +180,23 @@ protected:
 
     std::vector<node> nodesSortedByDistance;
 
+    // Nodes whose entries were set by the last run, valid if touchedNodesValid is true
+    std::vector<node> touchedNodes;
+    bool touchedNodesValid = false;
+
     bool storePaths;                 //!< if true, paths are reconstructable and the number of
                                      //!< paths is stored
     bool storeNodesSortedByDistance; //!< if true, store a vector of nodes
                                      //!< ordered in increasing distance from
                                      //!< the source
+
+    /**
+     * Prepares distances, predecessors and number of paths for a new run; all subsequently
+     * touched nodes must be appended to touchedNodes. If the last run recorded its touched nodes,
+     * only their entries are reset, so repeated local searches with the same object (see
+     * setSource()) run in time proportional to the explored part of the graph instead of O(n).
+     */
+    void resetResults();
 };
 
 inline edgeweight SSSP::distance(node t) const {
@@ -23,6 +23,21 @@ public:
 
     void update(const std::vector<GraphEvent> &stream);
 
+    /**
+     * Applies the events of @a stream in batches. Runs of consecutive edge events are grouped by
+     * their endpoints, so that e.g. an addition followed by a removal of the same edge cancels
+     * out, and the remaining adjacency changes are applied to all affected nodes in parallel.
+     * Node events and time steps are applied in stream order and separate the batches.
+     *
+     * The resulting graph has the same nodes, edges and edge weights as after update(), but the
+     * order of neighbors and the ids of new edges may differ. Multi-edges are not supported: an
+     * edge batch that adds an existing edge or removes a missing one is rejected with an
+     * exception before any of its events is applied.
+     *
+     * @param stream Sequence of graph events.
+     */
+    void updateBatch(const std::vector<GraphEvent> &stream);
+
     const std::vector<std::pair<count, count>> &getSizeTimeline() const;
 
     static bool compare(GraphEvent a, GraphEvent b);
@@ -31,6 +46,9 @@ public:
 private:
     Graph *G;
     std::vector<std::pair<count, count>> size;
+
+    void applyEvent(const GraphEvent &ev);
+    void applyEdgeBatch(const std::vector<GraphEvent> &stream, index begin, index end);
 };
 
 } /* namespace NetworKit */
@@ -8,6 +8,12 @@
 #ifndef NETWORKIT_GENERATORS_CHUNG_LU_GENERATOR_HPP_
 #define NETWORKIT_GENERATORS_CHUNG_LU_GENERATOR_HPP_
 
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/generators/StaticDegreeSequenceGenerator.hpp>
 
 namespace NetworKit {
@@ -27,6 +33,9 @@ namespace NetworKit {
  * http://aric.hagberg.org/papers/miller-2011-efficient.pdf .
  * It gives a complexity of O(n+m) as opposed to quadratic.
  *
+ * The nodes are numbered by descending expected degree, i.e., node u gets the u-th largest entry
+ * of the degree sequence. The neighbors of different nodes are sampled independently and thus in
+ * parallel.
  */
 
 class ChungLuGenerator final : public StaticDegreeSequenceGenerator {
@@ -40,6 +49,101 @@ public:
      * Generates graph with expected degree sequence seq.
      */
     Graph generate() override;
+
+    /**
+     * Generates the edges of a graph with expected degree sequence seq on the fly, without
+     * storing them. The edges are generated in parallel and the callback @a handle is invoked
+     * for each edge. Two signatures are supported for the callback:
+     *
+     *   (unsigned tid, node u, node v)
+     *   (node u, node v)
+     *
+     * where tid is the current thread id as returned by omp_get_thread_num() and u < v are the
+     * edge's nodes. It is guaranteed that no two threads emit edges for the same u.
+     *
+     * Returns number of edges produced.
+     */
+    template <typename Handle>
+    count forEdgesParallel(Handle handle) {
+        count numEdges = 0;
+#pragma omp parallel reduction(+ : numEdges)
+        {
+            const unsigned tid = omp_get_thread_num();
+
+            // the first nodes have the largest degrees, so the rows are handed out dynamically
+#pragma omp for schedule(dynamic, 64)
+            for (omp_index u = 0; u < static_cast<omp_index>(n); ++u)
+                numEdges += enumerate(handle, tid, static_cast<node>(u));
+        }
+        return numEdges;
+    }
+
+    /**
+     * Similarly to @ref forEdgesParallel but computed on one thread only.
+     * If the callback accepts three arguments tid is always 0.
+     */
+    template <typename Handle>
+    count forEdges(Handle handle) {
+        count numEdges = 0;
+        for (node u = 0; u < n; ++u)
+            numEdges += enumerate(handle, 0, u);
+        return numEdges;
+    }
+
+private:
+    // Emits the edges {u, v} with v > u.
+    template <typename Handle>
+    count enumerate(Handle &handle, unsigned tid, node u) const {
+        count numEdges = 0;
+        node v = u + 1;
+        if (v >= n)
+            return numEdges;
+
+        double p = edgeProbability(u, v);
+        while (p > 0) {
+            if (p != 1.0) {
+                // skip the node pairs that are rejected with probability 1 - p each
+                const double skip =
+                    std::floor(std::log(Aux::Random::probability()) / std::log(1 - p));
+                if (skip >= static_cast<double>(n - v))
+                    break;
+                v += static_cast<node>(skip);
+            }
+
+            /* The potential neighbor was selected with the probability p.
+             * In order to see if this neighbor should be rejected or accepted
+             * we correct the probability using q */
+            const double q = edgeProbability(u, v);
+            if (Aux::Random::probability() < q / p) {
+                callHandle(handle, tid, u, v);
+                ++numEdges;
+            }
+            p = q;
+            if (++v >= n)
+                break;
+        }
+
+        return numEdges;
+    }
+
+    double edgeProbability(node u, node v) const {
+        return std::min(static_cast<double>(seq[u]) * static_cast<double>(seq[v])
+                            / static_cast<double>(sum_deg),
+                        1.0);
+    }
+
+    // SFINAE to allow using functors with and without thread id as parameter
+    template <typename Handle>
+    static auto callHandle(Handle &h, unsigned tid, node u, node v)
+        -> decltype(h(0u, node{0}, node{0})) {
+        return h(tid, u, v);
+    }
+
+    template <typename Handle>
+    static auto callHandle(Handle &h, unsigned /*tid*/, node u, node v)
+        -> decltype(h(node{0}, node{0})) {
+        return h(u, v);
+    }
 };
 
 } /* namespace NetworKit */
@@ -0,0 +1,42 @@
+/*
+ * BinaryEventStream.hpp
+ *
+ * Definitions shared by BinaryEventStreamReader and BinaryEventStreamWriter.
+ * A description of the format can be found in networkit/cpp/io/BinaryEventStream.md.
+ */
+
+#ifndef NETWORKIT_IO_BINARY_EVENT_STREAM_HPP_
+#define NETWORKIT_IO_BINARY_EVENT_STREAM_HPP_
+
+#include <cstdint>
+
+namespace NetworKit {
+namespace nkbes {
+
+static constexpr char MAGIC[8] = "nkbes01";
+
+struct Header {
+    char magic[8];
+    uint64_t events;
+    uint64_t chunks;
+};
+
+//! Entry of the chunk table that directly follows the header.
+struct ChunkInfo {
+    uint64_t offset;     //!< position of the chunk relative to the begin of the file
+    uint64_t firstEvent; //!< index of the first event stored in the chunk
+};
+
+// Layout of the tag byte preceding each event.
+static constexpr uint8_t TYPE_MASK = 0x7; // bits 0-2: GraphEvent::Type
+static constexpr uint8_t HAS_U = 0x8;     // bit 3: event carries u
+static constexpr uint8_t HAS_V = 0x10;    // bit 4: event carries v
+static constexpr uint8_t HAS_W = 0x20;    // bit 5: event carries a non-default weight
+
+//! Upper bound on the size of a single encoded event in bytes.
+static constexpr uint64_t MAX_EVENT_SIZE = 1 + 9 + 9 + sizeof(double);
+
+} // namespace nkbes
+} // namespace NetworKit
+
+#endif // NETWORKIT_IO_BINARY_EVENT_STREAM_HPP_
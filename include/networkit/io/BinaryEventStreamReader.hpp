@@ -0,0 +1,93 @@
+/*
+ * BinaryEventStreamReader.hpp
+ */
+
+#ifndef NETWORKIT_IO_BINARY_EVENT_STREAM_READER_HPP_
+#define NETWORKIT_IO_BINARY_EVENT_STREAM_READER_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/io/BinaryEventStream.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ *
+ * Reads graph events written by BinaryEventStreamWriter. The file is memory-mapped, so events can
+ * either be decoded all at once (chunks are decoded in parallel) or streamed chunk by chunk,
+ * where each chunk forms one batch of events. Corrupt or truncated input is rejected with a
+ * std::runtime_error.
+ */
+class BinaryEventStreamReader final {
+
+public:
+    BinaryEventStreamReader() = default;
+
+    /**
+     * Opens (and memory-maps) the file at @a path.
+     */
+    explicit BinaryEventStreamReader(const std::string &path);
+
+    /**
+     * Opens (and memory-maps) the file at @a path and rewinds the stream.
+     */
+    void open(const std::string &path);
+
+    /**
+     * Reads events from a buffer filled by BinaryEventStreamWriter::writeToBuffer. The buffer is
+     * copied.
+     */
+    void openBuffer(const std::vector<uint8_t> &data);
+
+    /**
+     * Decodes all events of the stream.
+     */
+    std::vector<GraphEvent> read() const;
+
+    /**
+     * Decodes the next chunk into @a batch (replacing its content).
+     *
+     * @return false if the end of the stream has been reached, true otherwise.
+     */
+    bool nextBatch(std::vector<GraphEvent> &batch);
+
+    /**
+     * Passes the remaining chunks of the stream one by one to @a algo.updateBatch().
+     *
+     * @return The number of batches passed to @a algo.
+     */
+    count updateBatches(DynAlgorithm &algo);
+
+    /**
+     * Restarts streaming from the first chunk.
+     */
+    void rewind() noexcept { nextChunk = 0; }
+
+    count numberOfEvents() const noexcept { return header.events; }
+
+    count numberOfChunks() const noexcept { return header.chunks; }
+
+private:
+    MemoryMappedFile file;
+    std::vector<uint8_t> buffer;
+    const uint8_t *begin = nullptr;
+    const uint8_t *end = nullptr;
+    nkbes::Header header{};
+    std::vector<nkbes::ChunkInfo> chunks;
+    index nextChunk = 0;
+
+    void readHeader();
+    // Returns false if the chunk exceeds the end of the stream.
+    bool decodeChunk(index chunk, GraphEvent *out) const;
+    count chunkSize(index chunk) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_IO_BINARY_EVENT_STREAM_READER_HPP_
@@ -0,0 +1,53 @@
+/*
+ * BinaryEventStreamWriter.hpp
+ */
+
+#ifndef NETWORKIT_IO_BINARY_EVENT_STREAM_WRITER_HPP_
+#define NETWORKIT_IO_BINARY_EVENT_STREAM_WRITER_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <networkit/dynamics/GraphEvent.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ *
+ * Writes a sequence of graph events in a compact binary format. The events are split into
+ * chunks of at most @a eventsPerChunk events which are encoded independently (and in parallel):
+ * node ids are stored as variable-length deltas and edge weights are only stored if they differ
+ * from the default edge weight. The file can be read with BinaryEventStreamReader. A description
+ * of the format can be found in networkit/cpp/io/BinaryEventStream.md.
+ */
+class BinaryEventStreamWriter final {
+
+public:
+    /**
+     * @param eventsPerChunk Maximum number of events per chunk; the reader yields one chunk per
+     * batch.
+     */
+    BinaryEventStreamWriter(count eventsPerChunk = 65536);
+
+    void write(const std::vector<GraphEvent> &stream, const std::string &path);
+    std::vector<uint8_t> writeToBuffer(const std::vector<GraphEvent> &stream);
+
+    /**
+     * Converts the DGS file at @a dgsPath into the binary format. The parameters @a mapped and
+     * @a baseIndex are passed to DGSStreamParser.
+     */
+    void convertDGS(const std::string &dgsPath, const std::string &path, bool mapped = true,
+                    node baseIndex = 0);
+
+private:
+    count eventsPerChunk;
+
+    template <class T>
+    void writeData(T &outStream, const std::vector<GraphEvent> &stream);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_IO_BINARY_EVENT_STREAM_WRITER_HPP_
@@ -8,7 +8,7 @@
 #ifndef NETWORKIT_LINKPREDICTION_ADAMIC_ADAR_INDEX_HPP_
 #define NETWORKIT_LINKPREDICTION_ADAMIC_ADAR_INDEX_HPP_
 
-#include <networkit/linkprediction/LinkPredictor.hpp>
+#include <networkit/linkprediction/SortedNeighborhoods.hpp>
 
 namespace NetworKit {
 
@@ -19,7 +19,7 @@ namespace NetworKit {
  * The index sums up the reciprocals of the logarithm of the degree of all
  * common neighbors of u and v.
  */
-class AdamicAdarIndex final : public LinkPredictor {
+class AdamicAdarIndex final : public NeighborhoodPredictor {
     /**
      * Returns the Adamic/Adar Index of the given node-pair (@a u, @a v).
      * @param u First node
@@ -29,7 +29,7 @@ class AdamicAdarIndex final : public LinkPredictor {
     double runImpl(node u, node v) override;
 
 public:
-    using LinkPredictor::LinkPredictor;
+    using NeighborhoodPredictor::NeighborhoodPredictor;
 };
 
 } // namespace NetworKit
@@ -8,8 +8,7 @@
 #ifndef NETWORKIT_LINKPREDICTION_COMMON_NEIGHBORS_INDEX_HPP_
 #define NETWORKIT_LINKPREDICTION_COMMON_NEIGHBORS_INDEX_HPP_
 
-#include <networkit/linkprediction/LinkPredictor.hpp>
-#include <networkit/linkprediction/NeighborhoodUtility.hpp>
+#include <networkit/linkprediction/SortedNeighborhoods.hpp>
 
 namespace NetworKit {
 
@@ -19,7 +18,7 @@ namespace NetworKit {
  * The CommonNeighborsIndex calculates the number of common
  * neighbors of a node-pair in a given graph.
  */
-class CommonNeighborsIndex final : public LinkPredictor {
+class CommonNeighborsIndex final : public NeighborhoodPredictor {
     /**
      * Returns the number of common neighbors of the given nodes @a u and @a v.
      * @param u First node
@@ -27,11 +26,11 @@ class CommonNeighborsIndex final : public LinkPredictor {
      * @return the number of common neighbors of @a u and @a v
      */
     double runImpl(node u, node v) override {
-        return NeighborhoodUtility::getCommonNeighbors(*G, u, v).size();
+        return sortedNeighborhoods().numberOfCommonNeighbors(u, v);
     }
 
 public:
-    using LinkPredictor::LinkPredictor;
+    using NeighborhoodPredictor::NeighborhoodPredictor;
 };
 
 } // namespace NetworKit
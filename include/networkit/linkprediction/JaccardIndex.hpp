@@ -8,8 +8,7 @@
 #ifndef NETWORKIT_LINKPREDICTION_JACCARD_INDEX_HPP_
 #define NETWORKIT_LINKPREDICTION_JACCARD_INDEX_HPP_
 
-#include <networkit/linkprediction/LinkPredictor.hpp>
-#include <networkit/linkprediction/NeighborhoodUtility.hpp>
+#include <networkit/linkprediction/SortedNeighborhoods.hpp>
 
 namespace NetworKit {
 
@@ -20,7 +19,7 @@ namespace NetworKit {
  * This is done through dividing the number of common neighbors by the number of nodes
  * in the neighboorhood-union.
  */
-class JaccardIndex final : public LinkPredictor {
+class JaccardIndex final : public NeighborhoodPredictor {
     /**
      * Returns the Jaccard index for the given node-pair (@a u, @a v).
      * @param u First node
@@ -28,15 +27,17 @@ class JaccardIndex final : public LinkPredictor {
      * @return the Jaccard index for the given node-pair (@a u, @a v)
      */
     double runImpl(node u, node v) override {
-        const auto unionSize = NeighborhoodUtility::getNeighborsUnion(*G, u, v).size();
+        const SortedNeighborhoods &neighborhoods = sortedNeighborhoods();
+        const count commonNeighbors = neighborhoods.numberOfCommonNeighbors(u, v);
+        const count unionSize = neighborhoods.degree(u) + neighborhoods.degree(v) - commonNeighbors;
         if (unionSize == 0) {
             return 0;
         }
-        return 1.0 * NeighborhoodUtility::getCommonNeighbors(*G, u, v).size() / unionSize;
+        return 1.0 * commonNeighbors / unionSize;
     }
 
 public:
-    using LinkPredictor::LinkPredictor;
+    using NeighborhoodPredictor::NeighborhoodPredictor;
 };
 
 } // namespace NetworKit
@@ -91,6 +91,19 @@ public:
      * ascendingly by node-pair
      */
     virtual std::vector<prediction> runAll();
+
+    /**
+     * Returns the @a k highest scored node-pairs (u, v) with u < v that are not connected but
+     * have at least one common neighbor. Unlike runAll(), the candidates are not materialized at
+     * once: they are enumerated in parallel from the wedges of the graph in batches of at most
+     * @a batchSize wedges, every batch is scored by runOn() and only the best @a k predictions
+     * are kept. Ties are broken in favor of the smaller node-pair.
+     * @param k Number of node-pairs to return
+     * @param batchSize Upper bound on the number of wedges enumerated per batch; a single node
+     * may exceed it
+     * @return a vector of at most @a k predictions, sorted descendingly by score
+     */
+    virtual std::vector<prediction> runTopK(count k, count batchSize = count{1} << 20);
 };
 
 } // namespace NetworKit
@@ -10,7 +10,7 @@
 
 #include <cmath>
 
-#include <networkit/linkprediction/LinkPredictor.hpp>
+#include <networkit/linkprediction/SortedNeighborhoods.hpp>
 
 namespace NetworKit {
 
@@ -20,7 +20,7 @@ namespace NetworKit {
  * Assigns a distance value to pairs of nodes according to the
  * overlap of their neighborhoods.
  */
-class NeighborhoodDistanceIndex final : public LinkPredictor {
+class NeighborhoodDistanceIndex final : public NeighborhoodPredictor {
     /**
      * Returns the Neighborhood Distance index for the given node-pair (@a u, @a v).
      * @param u First node
@@ -30,12 +30,12 @@ class NeighborhoodDistanceIndex final : public LinkPredictor {
     double runImpl(node u, node v) override {
         count uNeighborhood = G->degree(u);
         count vNeighborhood = G->degree(v);
-        count intersection = NeighborhoodUtility::getCommonNeighbors(*G, u, v).size();
+        count intersection = sortedNeighborhoods().numberOfCommonNeighbors(u, v);
         return ((double)intersection) / (std::sqrt(uNeighborhood * vNeighborhood));
     }
 
 public:
-    using LinkPredictor::LinkPredictor;
+    using NeighborhoodPredictor::NeighborhoodPredictor;
 };
 
 } /* namespace NetworKit */
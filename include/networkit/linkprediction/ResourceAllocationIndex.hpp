@@ -8,7 +8,7 @@
 #ifndef NETWORKIT_LINKPREDICTION_RESOURCE_ALLOCATION_INDEX_HPP_
 #define NETWORKIT_LINKPREDICTION_RESOURCE_ALLOCATION_INDEX_HPP_
 
-#include <networkit/linkprediction/LinkPredictor.hpp>
+#include <networkit/linkprediction/SortedNeighborhoods.hpp>
 
 namespace NetworKit {
 
@@ -19,7 +19,7 @@ namespace NetworKit {
  * The index is similar to Adamic/Adar and sums up the reciprocals of
  * the degree of all common neighbors of u and v.
  */
-class ResourceAllocationIndex : public LinkPredictor {
+class ResourceAllocationIndex : public NeighborhoodPredictor {
 private:
     /**
      * Returns the Resource Allocation Index of the given node-pair (@a u, @a v).
@@ -30,7 +30,7 @@ private:
     double runImpl(node u, node v) override;
 
 public:
-    using LinkPredictor::LinkPredictor;
+    using NeighborhoodPredictor::NeighborhoodPredictor;
 };
 
 } // namespace NetworKit
@@ -0,0 +1,150 @@
+/*
+ * SortedNeighborhoods.hpp
+ *
+ * Sorted adjacency snapshot shared by the neighborhood-based link predictors.
+ */
+
+#ifndef NETWORKIT_LINKPREDICTION_SORTED_NEIGHBORHOODS_HPP_
+#define NETWORKIT_LINKPREDICTION_SORTED_NEIGHBORHOODS_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+#include <networkit/linkprediction/LinkPredictor.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup linkprediction
+ *
+ * Snapshot of the neighborhoods of all nodes of a graph in CSR format, where every neighborhood
+ * is sorted by node id. Intersections and unions of two neighborhoods are computed by merging
+ * the sorted ranges, or by galloping through the larger one if the sizes differ a lot, without
+ * allocating memory. All queries are thread-safe.
+ */
+class SortedNeighborhoods final {
+public:
+    SortedNeighborhoods() = default;
+
+    /**
+     * Takes a snapshot of the neighborhoods of @a G. Later changes of @a G are not reflected.
+     */
+    explicit SortedNeighborhoods(const Graph &G);
+
+    /**
+     * Returns the number of neighbors of @a u.
+     */
+    count degree(node u) const { return offsets[u + 1] - offsets[u]; }
+
+    /**
+     * Calls @a handle(w) for every common neighbor w of @a u and @a v in ascending order.
+     */
+    template <typename L>
+    void forCommonNeighbors(node u, node v, L &&handle) const;
+
+    /**
+     * Returns the number of common neighbors of @a u and @a v.
+     */
+    count numberOfCommonNeighbors(node u, node v) const {
+        count common = 0;
+        forCommonNeighbors(u, v, [&](node) { ++common; });
+        return common;
+    }
+
+    /**
+     * Returns the size of the union of the neighborhoods of @a u and @a v.
+     */
+    count neighborsUnionSize(node u, node v) const {
+        return degree(u) + degree(v) - numberOfCommonNeighbors(u, v);
+    }
+
+private:
+    // Merging is replaced by galloping if one neighborhood is this many times larger.
+    static constexpr std::ptrdiff_t gallopingRatio = 16;
+
+    std::vector<index> offsets;
+    std::vector<node> neighbors;
+};
+
+template <typename L>
+void SortedNeighborhoods::forCommonNeighbors(node u, node v, L &&handle) const {
+    const node *first1 = neighbors.data() + offsets[u], *last1 = neighbors.data() + offsets[u + 1];
+    const node *first2 = neighbors.data() + offsets[v], *last2 = neighbors.data() + offsets[v + 1];
+    if (last1 - first1 > last2 - first2) {
+        std::swap(first1, first2);
+        std::swap(last1, last2);
+    }
+
+    if ((last1 - first1) * gallopingRatio < last2 - first2) {
+        for (; first1 != last1 && first2 != last2; ++first1) {
+            const node x = *first1;
+            // find a range of the larger neighborhood that contains the lower bound of x
+            std::ptrdiff_t step = 1;
+            while (step < last2 - first2 && first2[step] < x)
+                step *= 2;
+            first2 = std::lower_bound(first2, first2 + std::min(step + 1, last2 - first2), x);
+            if (first2 != last2 && *first2 == x) {
+                handle(x);
+                ++first2;
+            }
+        }
+        return;
+    }
+
+    while (first1 != last1 && first2 != last2) {
+        if (*first1 < *first2) {
+            ++first1;
+        } else if (*first2 < *first1) {
+            ++first2;
+        } else {
+            handle(*first1);
+            ++first1;
+            ++first2;
+        }
+    }
+}
+
+/**
+ * @ingroup linkprediction
+ *
+ * Base class for link predictors that are computed from the neighborhoods of the two nodes.
+ * runOn(), runAll() and runTopK() take a new snapshot of the sorted neighborhoods of the graph
+ * before they start scoring, so they always reflect the current graph. Single calls of run()
+ * take the snapshot on first use and reuse it until the next call of setGraph(), runOn(),
+ * runAll() or runTopK(); call setGraph() again after modifying the graph in between.
+ */
+class NeighborhoodPredictor : public LinkPredictor {
+public:
+    NeighborhoodPredictor() = default;
+
+    explicit NeighborhoodPredictor(const Graph &G) : LinkPredictor(G) {}
+
+    void setGraph(const Graph &newGraph) override;
+
+    std::vector<prediction> runOn(std::vector<std::pair<node, node>> nodePairs) override;
+
+    std::vector<prediction> runTopK(count k, count batchSize = count{1} << 20) override;
+
+protected:
+    /**
+     * Returns the sorted neighborhoods of the graph, computing them first if necessary. Safe to
+     * call concurrently.
+     */
+    const SortedNeighborhoods &sortedNeighborhoods();
+
+private:
+    SortedNeighborhoods neighborhoods;
+    std::unique_ptr<std::once_flag> snapshotTaken = std::make_unique<std::once_flag>();
+    // Set while runTopK() scores its batches on a single snapshot.
+    bool keepSnapshot = false;
+
+    void takeSnapshot();
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_LINKPREDICTION_SORTED_NEIGHBORHOODS_HPP_
@@ -8,7 +8,7 @@
 #ifndef NETWORKIT_LINKPREDICTION_TOTAL_NEIGHBORS_INDEX_HPP_
 #define NETWORKIT_LINKPREDICTION_TOTAL_NEIGHBORS_INDEX_HPP_
 
-#include <networkit/linkprediction/LinkPredictor.hpp>
+#include <networkit/linkprediction/SortedNeighborhoods.hpp>
 
 namespace NetworKit {
 
@@ -19,7 +19,7 @@ namespace NetworKit {
  * This index is also known as Total Friends Index and returns
  * the number of nodes in the neighborhood-union of u and v.
  */
-class TotalNeighborsIndex final : public LinkPredictor {
+class TotalNeighborsIndex final : public NeighborhoodPredictor {
     /**
      * Returns the number of total union-neighbors for the given node-pair (@a u, @a v).
      * @param u First node
@@ -27,11 +27,11 @@ class TotalNeighborsIndex final : public LinkPredictor {
      * @return the number of total union-neighbors for the given node-pair (@a u, @a v)
      */
     double runImpl(node u, node v) override {
-        return NeighborhoodUtility::getNeighborsUnion(*G, u, v).size();
+        return sortedNeighborhoods().neighborsUnionSize(u, v);
     }
 
 public:
-    using LinkPredictor::LinkPredictor;
+    using NeighborhoodPredictor::NeighborhoodPredictor;
 };
 
 } // namespace NetworKit
@@ -16,7 +16,10 @@ namespace NetworKit {
 /**
  * @ingroup matching
  * LocalMax matching similar to the one described in the EuroPar13 paper
- * by the Sanders group (Birn, Osipov, Sanders, Schulz, Sitchinava)
+ * by the Sanders group (Birn, Osipov, Sanders, Schulz, Sitchinava).
+ * In every round, each unmatched node picks its heaviest edge to an unmatched neighbor in
+ * parallel, and edges picked by both endpoints are matched. Ties between edges of equal weight
+ * are broken randomly but consistently for both endpoints.
  */
 class LocalMaxMatcher final : public Matcher {
 public:
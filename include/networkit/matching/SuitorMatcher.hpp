@@ -11,6 +11,7 @@
 
 #include <vector>
 
+#include <networkit/auxiliary/SpinLock.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/matching/Matcher.hpp>
 
@@ -27,6 +28,13 @@ class SuitorMatcher final : public Matcher {
     void findSuitor(node current);
     void findSortSuitor(node current);
 
+    // Whether current would replace the suitor of v by proposing with an edge of weight weight.
+    bool isBetterSuitor(node current, node v, edgeweight weight) const;
+
+    // Makes current the suitor of partner if it is still better than the suitor of partner. On
+    // success, displaced is set to the previous suitor of partner.
+    bool propose(node current, node partner, edgeweight weight, node &displaced);
+
 public:
     /**
      * Computes a 1/2-approximation of the maximum (weighted) matching of an undirected graph using
@@ -34,7 +42,8 @@ public:
      * Matching Algorithms", IPDPS 2014. The algorithm has two versions: SortSuitor (faster, but
      * only works on graphs with adjacency lists sorted by non-increasing edge weight) and Suitor
      * (works on generic graphs). If using SortSuitor, use GrapTools::sortEdgesByWeight(G, true) to
-     * sort the adjacency lists by non-increasing edge weight.
+     * sort the adjacency lists by non-increasing edge weight. The nodes are processed in parallel;
+     * a proposal only locks the node it is made to.
      *
      * @param G An undirected graph.
      * @param sortSuitor If true uses the SortSuitor version, otherwise it uses Suitor.
@@ -56,6 +65,7 @@ private:
     std::vector<node> suitor;
     std::vector<edgeweight> ws;
     std::vector<index> neighborIterators;
+    std::vector<Aux::Spinlock> locks;
 };
 } // namespace NetworKit
 
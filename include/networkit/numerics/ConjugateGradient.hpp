@@ -8,11 +8,17 @@
 #ifndef NETWORKIT_NUMERICS_CONJUGATE_GRADIENT_HPP_
 #define NETWORKIT_NUMERICS_CONJUGATE_GRADIENT_HPP_
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <stdexcept>
 #include <utility>
+#include <vector>
+#include <omp.h>
 
 #include <networkit/algebraic/CSRMatrix.hpp>
 #include <networkit/algebraic/Vector.hpp>
+#include <networkit/auxiliary/Timer.hpp>
 #include <networkit/numerics/LinearSolver.hpp>
 
 namespace NetworKit {
@@ -52,7 +58,8 @@ public:
                        count maxIterations = std::numeric_limits<count>::max()) const override;
 
     /**
-     * Solves the linear systems in parallel.
+     * Solves the linear systems in parallel. The systems are solved in blocks of
+     * @ref DEFAULT_BLOCK_SIZE right-hand sides by @ref blockSolve.
      * @param rhs
      * @param results
      * @param maxConvergenceTime
@@ -63,6 +70,29 @@ public:
                   count maxConvergenceTime = 5 * 60 * 1000,
                   count maxIterations = std::numeric_limits<count>::max()) const override;
 
+    /**
+     * Solves the linear systems \f$Ax_i = b_i\f$ for all right-hand sides in @a rhs. Blocks of
+     * up to @a blockSize systems are solved simultaneously: the vectors of a block are stored
+     * row-major (the entries of all systems in the same row are adjacent), so that each iteration
+     * streams the matrix only once per block instead of once per system. Each system still runs
+     * its own conjugate gradient recurrence and stops as soon as it has converged. The entries of
+     * @a results are used as initial values. Preconditioners that provide
+     * rhs(const double *b, double *out, count n, count k) are applied to the whole block at once,
+     * other preconditioners column by column.
+     * @param rhs
+     * @param results
+     * @param blockSize Maximum number of systems that are solved simultaneously.
+     * @param maxConvergenceTime Maximum time in milliseconds spent on the systems of a block.
+     * @param maxIterations
+     * @return A @ref SolverStatus object for each right-hand side.
+     */
+    std::vector<SolverStatus>
+    blockSolve(const std::vector<Vector> &rhs, std::vector<Vector> &results,
+               count blockSize = DEFAULT_BLOCK_SIZE, count maxConvergenceTime = 5 * 60 * 1000,
+               count maxIterations = std::numeric_limits<count>::max()) const;
+
+    static constexpr count DEFAULT_BLOCK_SIZE = 8;
+
     /**
      * Abstract parallel solve function that computes and processes results using @a resultProcessor
      * for the matrix currently setup and the right-hand sides (size of @a rhsSize) provided by @a
@@ -100,6 +130,30 @@ public:
 private:
     Matrix matrix;
     Preconditioner precond;
+
+    std::vector<SolverStatus> solveBlock(const std::vector<Vector> &rhs,
+                                         std::vector<Vector> &results, index first, count k,
+                                         count maxConvergenceTime, count maxIterations) const;
+
+    // Y = A * X for row-major n x k multi-vectors.
+    void multiply(const std::vector<double> &X, std::vector<double> &Y, count k) const;
+
+    // Returns f(i, 0) + ... + f(n - 1, 0), ..., f(0, k - 1) + ... + f(n - 1, k - 1).
+    template <typename F>
+    static std::vector<double> columnSums(count n, count k, F f);
+
+    // Z = precond(R) for row-major n x k multi-vectors. Preconditioners that provide
+    // rhs(const double *, double *, count n, count k) are applied to the whole block at once.
+    template <class P>
+    static auto preconditionBlock(const P &precond, const std::vector<double> &R,
+                                  std::vector<double> &Z, count k, std::vector<Vector> &scratch,
+                                  int) -> decltype(precond.rhs(R.data(), Z.data(), count{0}, k),
+                                                   void());
+
+    template <class P>
+    static void preconditionBlock(const P &precond, const std::vector<double> &R,
+                                  std::vector<double> &Z, count k, std::vector<Vector> &scratch,
+                                  long);
 };
 
 template <class Matrix, class Preconditioner>
@@ -107,6 +161,16 @@ SolverStatus ConjugateGradient<Matrix, Preconditioner>::solve(const Vector &rhs,
                                                               count, count maxIterations) const {
     assert(matrix.numberOfRows() == rhs.getDimension());
 
+    SolverStatus status;
+    if (rhs.length() == 0.) {
+        // the solution is zero, the relative residual below would be undefined
+        result.fill(0.);
+        status.numIters = 0;
+        status.residual = 0.;
+        status.converged = true;
+        return status;
+    }
+
     // Absolute residual to achieve
     double sqr_desired_residual = this->tolerance * this->tolerance * (rhs.length() * rhs.length());
 
@@ -125,20 +189,19 @@ SolverStatus ConjugateGradient<Matrix, Preconditioner>::solve(const Vector &rhs,
             break;
         }
 
+        // The vector updates are done in place to avoid temporaries and extra passes over memory.
         tmp = matrix * conjugate_dir;
         double step = sqr_residual_precond / Vector::innerProduct(conjugate_dir, tmp);
-        result += step * conjugate_dir;
-        residual_dir -= step * tmp;
-        sqr_residual = Vector::innerProduct(residual_dir, residual_dir);
+        result.addScaled(step, conjugate_dir);
+        sqr_residual = residual_dir.addScaledAndSquaredLength(-step, tmp);
 
         residual_precond = precond.rhs(residual_dir);
         double new_sqr_residual_precond = Vector::innerProduct(residual_dir, residual_precond);
-        conjugate_dir =
-            (new_sqr_residual_precond / sqr_residual_precond) * conjugate_dir + residual_precond;
+        conjugate_dir.scaleAndAdd(new_sqr_residual_precond / sqr_residual_precond,
+                                  residual_precond);
         sqr_residual_precond = new_sqr_residual_precond;
     }
 
-    SolverStatus status;
     status.numIters = niters;
     status.residual = (rhs - matrix * result).length();
     status.converged = status.residual / rhs.length() <= this->tolerance;
@@ -150,14 +213,230 @@ template <class Matrix, class Preconditioner>
 std::vector<SolverStatus> ConjugateGradient<Matrix, Preconditioner>::parallelSolve(
     const std::vector<Vector> &rhs, std::vector<Vector> &results, count maxConvergenceTime,
     count maxIterations) const {
-    std::vector<SolverStatus> stati(rhs.size());
+    return blockSolve(rhs, results, DEFAULT_BLOCK_SIZE, maxConvergenceTime, maxIterations);
+}
+
+template <class Matrix, class Preconditioner>
+std::vector<SolverStatus>
+ConjugateGradient<Matrix, Preconditioner>::blockSolve(const std::vector<Vector> &rhs,
+                                                      std::vector<Vector> &results,
+                                                      count blockSize, count maxConvergenceTime,
+                                                      count maxIterations) const {
+    assert(rhs.size() == results.size());
+    if (blockSize == 0)
+        throw std::invalid_argument("Error, the block size must be positive.");
+
+    std::vector<SolverStatus> stati;
+    stati.reserve(rhs.size());
+    for (index first = 0; first < rhs.size(); first += blockSize) {
+        const count k = std::min<count>(blockSize, rhs.size() - first);
+        const auto blockStati =
+            solveBlock(rhs, results, first, k, maxConvergenceTime, maxIterations);
+        stati.insert(stati.end(), blockStati.begin(), blockStati.end());
+    }
+    return stati;
+}
+
+template <class Matrix, class Preconditioner>
+std::vector<SolverStatus> ConjugateGradient<Matrix, Preconditioner>::solveBlock(
+    const std::vector<Vector> &rhs, std::vector<Vector> &results, index first, count k,
+    count maxConvergenceTime, count maxIterations) const {
+    Aux::StartedTimer timer;
+    const count n = matrix.numberOfRows();
+
+    // Row-major multi-vectors: entry (i, c) of system first + c is stored at i * k + c.
+    std::vector<double> B(n * k), X(n * k);
 #pragma omp parallel for
-    for (omp_index i = 0; i < static_cast<omp_index>(rhs.size()); ++i) {
-        stati[i] = this->solve(rhs[i], results[i], maxConvergenceTime, maxIterations);
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        for (index c = 0; c < k; ++c) {
+            B[i * k + c] = rhs[first + c][i];
+            X[i * k + c] = results[first + c][i];
+        }
+    }
+
+    // Scratch vectors for preconditioners that only act on single vectors.
+    std::vector<Vector> scratch;
+    const auto precondition = [&](const std::vector<double> &R, std::vector<double> &Z) {
+        preconditionBlock(precond, R, Z, k, scratch, 0);
+    };
+
+    // See solve() for the single-vector version of the main loop.
+    std::vector<double> R(n * k), Z(n * k), P(n * k), Q(n * k);
+    multiply(X, R, k);
+#pragma omp parallel for
+    for (omp_index j = 0; j < static_cast<omp_index>(n * k); ++j)
+        R[j] = B[j] - R[j];
+    precondition(R, Z);
+    P = Z;
+
+    const auto sqrRhs =
+        columnSums(n, k, [&](index i, index c) { return B[i * k + c] * B[i * k + c]; });
+    auto sqrResidual =
+        columnSums(n, k, [&](index i, index c) { return R[i * k + c] * R[i * k + c]; });
+    auto sqrResidualPrecond =
+        columnSums(n, k, [&](index i, index c) { return R[i * k + c] * Z[i * k + c]; });
+
+    std::vector<double> sqrDesiredResidual(k), step(k, 0), beta(k, 0);
+    std::vector<count> iterations(k, 0);
+    std::vector<uint8_t> active(k);
+    for (index c = 0; c < k; ++c) {
+        sqrDesiredResidual[c] = this->tolerance * this->tolerance * sqrRhs[c];
+        active[c] = sqrRhs[c] > 0 && sqrResidual[c] > sqrDesiredResidual[c];
+    }
+
+    // Systems with a zero right-hand side have the solution zero.
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        for (index c = 0; c < k; ++c) {
+            if (sqrRhs[c] == 0.)
+                X[i * k + c] = 0.;
+        }
+    }
+
+    const auto anyActive = [&]() {
+        return std::find(active.begin(), active.end(), 1) != active.end();
+    };
+    while (anyActive()) {
+        const bool timedOut = timer.elapsedMilliseconds() > maxConvergenceTime;
+        for (index c = 0; c < k; ++c) {
+            if (active[c] && (timedOut || ++iterations[c] > maxIterations)) {
+                iterations[c] = std::min(iterations[c], maxIterations);
+                active[c] = false;
+            }
+        }
+        if (!anyActive())
+            break;
+
+        multiply(P, Q, k);
+        const auto pq =
+            columnSums(n, k, [&](index i, index c) { return P[i * k + c] * Q[i * k + c]; });
+        for (index c = 0; c < k; ++c)
+            step[c] = active[c] ? sqrResidualPrecond[c] / pq[c] : 0.;
+
+        // x += step * p, r -= step * q and ||r||^2 in one pass
+        sqrResidual = columnSums(n, k, [&](index i, index c) {
+            const index j = i * k + c;
+            X[j] += step[c] * P[j];
+            R[j] -= step[c] * Q[j];
+            return R[j] * R[j];
+        });
+
+        precondition(R, Z);
+        const auto newSqrResidualPrecond =
+            columnSums(n, k, [&](index i, index c) { return R[i * k + c] * Z[i * k + c]; });
+        for (index c = 0; c < k; ++c) {
+            beta[c] = active[c] ? newSqrResidualPrecond[c] / sqrResidualPrecond[c] : 0.;
+            if (active[c])
+                sqrResidualPrecond[c] = newSqrResidualPrecond[c];
+        }
+
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+            for (index c = 0; c < k; ++c) {
+                if (active[c])
+                    P[i * k + c] = beta[c] * P[i * k + c] + Z[i * k + c];
+            }
+        }
+
+        for (index c = 0; c < k; ++c)
+            active[c] = active[c] && sqrResidual[c] > sqrDesiredResidual[c];
+    }
+
+    // final residuals
+    multiply(X, R, k);
+    const auto sqrFinalResidual = columnSums(n, k, [&](index i, index c) {
+        const double r = B[i * k + c] - R[i * k + c];
+        return r * r;
+    });
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        for (index c = 0; c < k; ++c)
+            results[first + c][i] = X[i * k + c];
+    }
+
+    std::vector<SolverStatus> stati(k);
+    for (index c = 0; c < k; ++c) {
+        stati[c].numIters = iterations[c];
+        stati[c].residual = std::sqrt(sqrFinalResidual[c]);
+        stati[c].converged = sqrRhs[c] == 0.
+                             || stati[c].residual / std::sqrt(sqrRhs[c]) <= this->tolerance;
     }
     return stati;
 }
 
+template <class Matrix, class Preconditioner>
+void ConjugateGradient<Matrix, Preconditioner>::multiply(const std::vector<double> &X,
+                                                         std::vector<double> &Y, count k) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
+        double *y = Y.data() + i * k;
+        std::fill(y, y + k, 0.);
+        matrix.forNonZeroElementsInRow(i, [&](index j, double value) {
+            const double *x = X.data() + j * k;
+            for (index c = 0; c < k; ++c)
+                y[c] += value * x[c];
+        });
+    }
+}
+
+template <class Matrix, class Preconditioner>
+template <typename F>
+std::vector<double> ConjugateGradient<Matrix, Preconditioner>::columnSums(count n, count k, F f) {
+    // The rows are summed up in fixed chunks whose sums are added in order, so the result does
+    // not depend on the number of threads or the scheduling.
+    constexpr count chunkSize = 1024;
+    const count numChunks = (n + chunkSize - 1) / chunkSize;
+    std::vector<double> chunkSums(numChunks * k, 0.);
+#pragma omp parallel for schedule(guided)
+    for (omp_index chunk = 0; chunk < static_cast<omp_index>(numChunks); ++chunk) {
+        double *localSums = chunkSums.data() + chunk * k;
+        const index end = std::min<index>(n, (chunk + 1) * chunkSize);
+        for (index i = chunk * chunkSize; i < end; ++i) {
+            for (index c = 0; c < k; ++c)
+                localSums[c] += f(i, c);
+        }
+    }
+
+    std::vector<double> sums(k, 0.);
+    for (index chunk = 0; chunk < numChunks; ++chunk) {
+        for (index c = 0; c < k; ++c)
+            sums[c] += chunkSums[chunk * k + c];
+    }
+    return sums;
+}
+
+template <class Matrix, class Preconditioner>
+template <class P>
+auto ConjugateGradient<Matrix, Preconditioner>::preconditionBlock(const P &precond,
+                                                                  const std::vector<double> &R,
+                                                                  std::vector<double> &Z, count k,
+                                                                  std::vector<Vector> &, int)
+    -> decltype(precond.rhs(R.data(), Z.data(), count{0}, k), void()) {
+    precond.rhs(R.data(), Z.data(), R.size() / k, k);
+}
+
+template <class Matrix, class Preconditioner>
+template <class P>
+void ConjugateGradient<Matrix, Preconditioner>::preconditionBlock(const P &precond,
+                                                                  const std::vector<double> &R,
+                                                                  std::vector<double> &Z, count k,
+                                                                  std::vector<Vector> &scratch,
+                                                                  long) {
+    // Each column is copied into a scratch vector of the thread and preconditioned on its own.
+    const count n = R.size() / k;
+    scratch.resize(std::min<count>(k, omp_get_max_threads()), Vector(n));
+#pragma omp parallel for schedule(dynamic) num_threads(static_cast<int>(scratch.size()))
+    for (omp_index c = 0; c < static_cast<omp_index>(k); ++c) {
+        Vector &column = scratch[omp_get_thread_num()];
+        for (index i = 0; i < n; ++i)
+            column[i] = R[i * k + c];
+        const Vector z = precond.rhs(column);
+        for (index i = 0; i < n; ++i)
+            Z[i * k + c] = z[i];
+    }
+}
+
 } /* namespace NetworKit */
 
 #endif // NETWORKIT_NUMERICS_CONJUGATE_GRADIENT_HPP_
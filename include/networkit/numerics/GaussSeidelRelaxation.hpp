@@ -8,6 +8,11 @@
 #ifndef NETWORKIT_NUMERICS_GAUSS_SEIDEL_RELAXATION_HPP_
 #define NETWORKIT_NUMERICS_GAUSS_SEIDEL_RELAXATION_HPP_
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
 #include <networkit/numerics/Smoother.hpp>
 
 namespace NetworKit {
@@ -52,6 +57,18 @@ public:
      */
     Vector relax(const Matrix &A, const Vector &b,
                  count maxIterations = std::numeric_limits<count>::max()) const override;
+
+    /**
+     * Relaxes all systems A * X[i] = B[i] simultaneously, so that every sweep streams @a A only
+     * once for the whole block. Each system stops on its own, exactly like a single relax() with
+     * the initial guess X[i] would, and X[i] is overwritten by its result.
+     * @param A The matrix.
+     * @param B The right-hand sides.
+     * @param X The initial guesses and the (approximate) solutions.
+     * @param maxIterations
+     */
+    void blockRelax(const Matrix &A, const std::vector<Vector> &B, std::vector<Vector> &X,
+                    count maxIterations = std::numeric_limits<count>::max()) const override;
 };
 
 template <class Matrix>
@@ -94,6 +111,65 @@ Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix &A, const Vector &b,
     return relax(A, b, x, maxIterations);
 }
 
+template <class Matrix>
+void GaussSeidelRelaxation<Matrix>::blockRelax(const Matrix &A, const std::vector<Vector> &B,
+                                               std::vector<Vector> &X,
+                                               const count maxIterations) const {
+    if (maxIterations == 0 || B.empty())
+        return;
+
+    const count dimension = A.numberOfColumns();
+    const Vector diagonal = A.diagonal();
+
+    // systems whose relative residual is still above the tolerance
+    std::vector<index> active(B.size());
+    std::iota(active.begin(), active.end(), 0);
+    std::vector<double> sigma(B.size()), sqrResidual(B.size());
+
+    count iterations = 0;
+    do {
+        const count k = active.size();
+        for (index i = 0; i < dimension; ++i) {
+            std::fill_n(sigma.begin(), k, 0.0);
+            A.forNonZeroElementsInRow(i, [&](index column, double value) {
+                if (column != i) {
+                    for (index a = 0; a < k; ++a)
+                        sigma[a] += value * X[active[a]][column];
+                }
+            });
+
+            for (index a = 0; a < k; ++a)
+                X[active[a]][i] = (B[active[a]][i] - sigma[a]) / diagonal[i];
+        }
+
+        iterations++;
+        if (iterations == maxIterations)
+            break;
+
+        // residuals of all active systems in one pass over A
+        std::fill_n(sqrResidual.begin(), k, 0.0);
+        for (index i = 0; i < dimension; ++i) {
+            std::fill_n(sigma.begin(), k, 0.0);
+            A.forNonZeroElementsInRow(i, [&](index column, double value) {
+                for (index a = 0; a < k; ++a)
+                    sigma[a] += value * X[active[a]][column];
+            });
+
+            for (index a = 0; a < k; ++a) {
+                const double r = sigma[a] - B[active[a]][i];
+                sqrResidual[a] += r * r;
+            }
+        }
+
+        index kept = 0;
+        for (index a = 0; a < k; ++a) {
+            if (std::sqrt(sqrResidual[a]) / B[active[a]].length() > tolerance)
+                active[kept++] = active[a];
+        }
+        active.resize(kept);
+    } while (!active.empty());
+}
+
 } /* namespace NetworKit */
 
 #endif // NETWORKIT_NUMERICS_GAUSS_SEIDEL_RELAXATION_HPP_
@@ -8,6 +8,7 @@
 #ifndef NETWORKIT_NUMERICS_LAMG_LAMG_HPP_
 #define NETWORKIT_NUMERICS_LAMG_LAMG_HPP_
 
+#include <algorithm>
 #include <omp.h>
 #include <vector>
 
@@ -76,6 +77,11 @@ private:
     SolverStatus solveThread(const Vector &rhs, Vector &result, count maxConvergenceTime,
                              count maxIterations, index threadId) const;
 
+    // solves the systems rhs[first], ..., rhs[first + k - 1] simultaneously on the given thread
+    void solveThreadBlock(const std::vector<Vector> &rhs, std::vector<Vector> &results,
+                          std::vector<SolverStatus> &stati, index first, count k,
+                          count maxConvergenceTime, count maxIterations, index threadId) const;
+
 public:
     /**
      * Construct a solver with the given @a tolerance. The relative residual ||Ax-b||/||b|| will be
@@ -167,7 +173,9 @@ public:
     /**
      * Compute the @a results for the matrix currently setup and the right-hand sides @a rhs.
      * The maximum spent time for each system can be specified by @a maxConvergenceTime and the
-     * maximum number of iterations can be set by @a maxIterations.
+     * maximum number of iterations can be set by @a maxIterations. Every thread solves blocks of
+     * up to @ref DEFAULT_BLOCK_SIZE systems, whose multigrid cycles run simultaneously, so that
+     * the matrices of the hierarchy are streamed once per block instead of once per system.
      * @param rhs
      * @param results
      * @param maxConvergenceTime
@@ -178,6 +186,8 @@ public:
                   count maxConvergenceTime = 5 * 60 * 1000,
                   count maxIterations = std::numeric_limits<count>::max()) const override;
 
+    static constexpr count DEFAULT_BLOCK_SIZE = 8;
+
     /**
      * Abstract parallel solve function that computes and processes results using @a resultProcessor
      * for the matrix currently setup and the right-hand sides (size of @a rhsSize) provided by @a
@@ -430,6 +440,80 @@ SolverStatus Lamg<Matrix>::solveThread(const Vector &rhs, Vector &result, count
     return status;
 }
 
+template <class Matrix>
+void Lamg<Matrix>::solveThreadBlock(const std::vector<Vector> &rhs, std::vector<Vector> &results,
+                                    std::vector<SolverStatus> &stati, const index first,
+                                    const count k, count maxConvergenceTime, count maxIterations,
+                                    const index threadId) const {
+    if (!validSetup)
+        throw std::runtime_error("LAMG is not properly setup!");
+    for (index i = first; i < first + k; ++i) {
+        if (results[i].getDimension() != laplacianMatrix.numberOfColumns()
+            || rhs[i].getDimension() != laplacianMatrix.numberOfRows()) {
+            throw std::runtime_error("Wrong matrix dimensions for given vectors.");
+        }
+    }
+
+    // see solveThread() for the single-vector version
+    std::vector<Vector> blockRhs(k), blockResults(k);
+    std::vector<LAMGSolverStatus> blockStati(k);
+    std::vector<count> maxIters(k, 0);
+    for (index componentId = 0; componentId < numComponents; ++componentId) {
+        const auto &hierarchy = compHierarchies[componentId];
+        for (index i = 0; i < k; ++i) {
+            if (numComponents == 1) {
+                blockRhs[i] = rhs[first + i];
+                blockResults[i] = results[first + i];
+            } else {
+                blockRhs[i] = Vector(components[componentId].size());
+                blockResults[i] = Vector(components[componentId].size());
+                for (auto element : components[componentId]) {
+                    blockResults[i][graph2Components[element]] = results[first + i][element];
+                    blockRhs[i][graph2Components[element]] = rhs[first + i][element];
+                }
+            }
+
+            LAMGSolverStatus &stat = blockStati[i];
+            stat = compStati[threadId][componentId];
+            stat.residualHistory.clear();
+            const double resReduction =
+                this->tolerance * blockRhs[i].length()
+                / (hierarchy.at(0).getLaplacian() * blockResults[i] - blockRhs[i]).length();
+            stat.desiredResidualReduction = numComponents == 1
+                                                ? resReduction
+                                                : resReduction * components[componentId].size()
+                                                      / laplacianMatrix.numberOfRows();
+            stat.maxIters = maxIterations;
+            stat.maxConvergenceTime = maxConvergenceTime;
+        }
+
+        compSolvers[threadId][componentId].solveBlock(blockResults, blockRhs, blockStati);
+
+        for (index i = 0; i < k; ++i) {
+            if (numComponents == 1) {
+                results[first + i] = std::move(blockResults[i]);
+            } else {
+                for (auto element : components[componentId]) {
+                    results[first + i][element] = blockResults[i][graph2Components[element]];
+                }
+            }
+            maxIters[i] = std::max(maxIters[i], blockStati[i].numIters);
+        }
+    }
+
+    for (index i = 0; i < k; ++i) {
+        SolverStatus &status = stati[first + i];
+        status.numIters = maxIters[i];
+        if (numComponents == 1) {
+            status.residual = blockStati[i].residual;
+            status.converged = blockStati[i].converged;
+        } else {
+            status.residual = (rhs[first + i] - laplacianMatrix * results[first + i]).length();
+            status.converged = status.residual <= this->tolerance;
+        }
+    }
+}
+
 template <class Matrix>
 SolverStatus Lamg<Matrix>::solve(const Vector &rhs, Vector &result, count maxConvergenceTime,
                                  count maxIterations) const {
@@ -442,10 +526,18 @@ Lamg<Matrix>::parallelSolve(const std::vector<Vector> &rhs, std::vector<Vector>
                             count maxConvergenceTime, count maxIterations) const {
     std::vector<SolverStatus> stati(rhs.size());
 
-#pragma omp parallel for
-    for (omp_index i = 0; i < static_cast<omp_index>(rhs.size()); ++i) {
-        const index threadId = omp_get_thread_num();
-        stati[i] = solveThread(rhs[i], results[i], maxConvergenceTime, maxIterations, threadId);
+    // Smaller blocks if there are not enough systems to keep all threads busy.
+    const count numThreads = static_cast<count>(omp_get_max_threads());
+    const count systemsPerThread = (rhs.size() + numThreads - 1) / numThreads;
+    const count blockSize = std::max<count>(1, std::min(DEFAULT_BLOCK_SIZE, systemsPerThread));
+    const count numBlocks = (rhs.size() + blockSize - 1) / blockSize;
+
+#pragma omp parallel for schedule(dynamic)
+    for (omp_index block = 0; block < static_cast<omp_index>(numBlocks); ++block) {
+        const index first = block * blockSize;
+        const count k = std::min<count>(blockSize, rhs.size() - first);
+        solveThreadBlock(rhs, results, stati, first, k, maxConvergenceTime, maxIterations,
+                         omp_get_thread_num());
     }
 
     return stati;
@@ -11,10 +11,13 @@
 #include <networkit/algebraic/CSRMatrix.hpp>
 #include <networkit/algebraic/DenseMatrix.hpp>
 #include <networkit/algebraic/DynamicMatrix.hpp>
+#include <networkit/algebraic/SparseAccumulator.hpp>
 #include <networkit/numerics/LAMG/LevelHierarchy.hpp>
 #include <networkit/numerics/Smoother.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <vector>
 
@@ -67,6 +70,19 @@ private:
     void eliminationOperators(const Matrix &matrix, const std::vector<index> &fSet,
                               const std::vector<index> &coarseIndex, Matrix &P, Vector &q) const;
 
+    /**
+     * Computes the entries of the projection matrix and the @a q vector of an elimination stage in
+     * parallel. The entries are stored row by row in @a triples.
+     * @param matrix Laplacian matrix.
+     * @param fSet Set of nodes having low degree.
+     * @param coarseIndex Set of nodes equal to V \setminus fSet
+     * @param triples[out] The entries of the projection matrix.
+     * @param q[out] The q vector.
+     */
+    void eliminationTriplets(const Matrix &matrix, const std::vector<index> &fSet,
+                             const std::vector<index> &coarseIndex, std::vector<Triplet> &triples,
+                             Vector &q) const;
+
     /**
      * Aggregation phase of LAMG for the specified Laplacian matrix @a matrix. The coarsened matrix
      * is stored in the LevelHierarchy @a hierarchy. The test vector @a tv is used for determining
@@ -334,23 +350,70 @@ bool MultiLevelSetup<Matrix>::coarseningElimination(Matrix &matrix,
 template <class Matrix>
 count MultiLevelSetup<Matrix>::lowDegreeSweep(const Matrix &matrix, std::vector<bool> &fNode,
                                               index stage) const {
-    fNode.resize(matrix.numberOfRows(), true); // first mark all nodes as f nodes
-    count numFNodes = 0;
-    int degreeOffset = stage != 0;
+    // A low degree node becomes an f node iff none of its neighbors with a smaller index is an f
+    // node, i.e. we compute the same independent set as a sweep in increasing index order. Each
+    // node is decided in parallel as soon as all of its lower indexed neighbors are decided.
+    enum : uint8_t { PENDING, F_NODE, C_NODE };
+    const count n = matrix.numberOfRows();
+    const int degreeOffset = stage != 0;
+    std::vector<uint8_t> state(n);
 
-    for (index i = 0; i < matrix.numberOfRows(); ++i) {
-        if ((int)matrix.nnzInRow(i) - degreeOffset <= (int)SETUP_ELIMINATION_MAX_DEGREE
-            && fNode[i]) { // node i has degree <= 4 and can be eliminated
-            numFNodes++;
-            // To maintain independence, mark all neighbors  as not eliminated all neighbors of this
-            // f node are c nodes
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        // only nodes with degree <= 4 can be eliminated
+        state[i] = (int)matrix.nnzInRow(i) - degreeOffset <= (int)SETUP_ELIMINATION_MAX_DEGREE
+                       ? PENDING
+                       : C_NODE;
+    }
+
+    std::vector<index> pending;
+    for (index i = 0; i < n; ++i) {
+        if (state[i] == PENDING)
+            pending.push_back(i);
+    }
+
+    while (!pending.empty()) {
+        // without atomic read and write, the nodes are decided sequentially
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for schedule(static)
+#endif // NETWORKIT_OMP2
+        for (omp_index k = 0; k < static_cast<omp_index>(pending.size()); ++k) {
+            const index i = pending[k];
+            uint8_t decision = F_NODE;
             matrix.forNonZeroElementsInRow(i, [&](index j, edgeweight /*w*/) {
-                if (j != i) {
-                    fNode[j] = false;
-                }
+                if (j >= i)
+                    return;
+                uint8_t neighborState;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic read
+#endif // NETWORKIT_OMP2
+                neighborState = state[j];
+                if (neighborState == F_NODE)
+                    decision = C_NODE; // to maintain independence
+                else if (neighborState == PENDING && decision == F_NODE)
+                    decision = PENDING;
             });
-        } else { // Node has high degree, thus it is a c node
-            fNode[i] = false;
+
+            if (decision != PENDING) {
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic write
+#endif // NETWORKIT_OMP2
+                state[i] = decision;
+            }
+        }
+
+        // the pending node with the smallest index is always decided, so this terminates
+        pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                     [&](index i) { return state[i] != PENDING; }),
+                      pending.end());
+    }
+
+    fNode.assign(n, false);
+    count numFNodes = 0;
+    for (index i = 0; i < n; ++i) {
+        if (state[i] == F_NODE) {
+            fNode[i] = true;
+            numFNodes++;
         }
     }
 
@@ -363,22 +426,43 @@ void MultiLevelSetup<Matrix>::eliminationOperators(const Matrix &matrix,
                                                    const std::vector<index> &coarseIndex, Matrix &P,
                                                    Vector &q) const {
     std::vector<Triplet> triples;
+    eliminationTriplets(matrix, fSet, coarseIndex, triples, q);
+
+    P = Matrix(fSet.size(), coarseIndex.size() - fSet.size(), triples);
+}
+
+template <class Matrix>
+void MultiLevelSetup<Matrix>::eliminationTriplets(const Matrix &matrix,
+                                                  const std::vector<index> &fSet,
+                                                  const std::vector<index> &coarseIndex,
+                                                  std::vector<Triplet> &triples, Vector &q) const {
     q = Vector(fSet.size());
-    for (index k = 0; k < fSet.size(); ++k) { // Afc
+    std::vector<index> rowBegin(fSet.size() + 1, 0);
+#pragma omp parallel for
+    for (omp_index k = 0; k < static_cast<omp_index>(fSet.size()); ++k) {
         matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
             if (fSet[k] == j) {
                 q[k] = 1.0 / w;
             } else {
-                triples.push_back({k, coarseIndex[j], w});
+                ++rowBegin[k + 1];
             }
         });
     }
 
-    for (index i = 0; i < triples.size(); ++i) { // * -Aff^-1
-        triples[i].value *= -q[triples[i].row];
+    for (index k = 0; k < fSet.size(); ++k) {
+        rowBegin[k + 1] += rowBegin[k];
     }
 
-    P = Matrix(fSet.size(), coarseIndex.size() - fSet.size(), triples);
+    triples.resize(rowBegin[fSet.size()]);
+#pragma omp parallel for
+    for (omp_index k = 0; k < static_cast<omp_index>(fSet.size()); ++k) { // Afc * -Aff^-1
+        index pos = rowBegin[k];
+        matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
+            if (fSet[k] != j) {
+                triples[pos++] = {static_cast<index>(k), coarseIndex[j], -q[k] * w};
+            }
+        });
+    }
 }
 
 template <class Matrix>
@@ -439,7 +523,8 @@ void MultiLevelSetup<Matrix>::coarseningAggregation(Matrix &matrix,
         }
     }
 
-    for (index i = 0; i < matrix.numberOfRows(); ++i) {
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
         if (S[bestAggregate][i] == UNDECIDED) { // undediced nodes become their own seeds
             S[bestAggregate][i] = i;
         }
@@ -453,7 +538,8 @@ void MultiLevelSetup<Matrix>::coarseningAggregation(Matrix &matrix,
         }
     }
 
-    for (index i = 0; i < matrix.numberOfRows(); ++i) {
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
         status[i] = indexFine[S[bestAggregate][i]];
     }
 
@@ -465,10 +551,14 @@ void MultiLevelSetup<Matrix>::coarseningAggregation(Matrix &matrix,
     std::vector<index> PColIndex(matrix.numberOfRows());
     std::vector<std::vector<index>> PRowIndex(nc[bestAggregate]);
 
-    for (index i = 0; i < matrix.numberOfRows(); ++i) {
-        pTriples[i] = {i, status[i], 1};
-        rTriples[i] = {status[i], i, 1};
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
+        pTriples[i] = {static_cast<index>(i), status[i], 1};
+        rTriples[i] = {status[i], static_cast<index>(i), 1};
         PColIndex[i] = status[i];
+    }
+
+    for (index i = 0; i < matrix.numberOfRows(); ++i) {
         PRowIndex[status[i]].push_back(i);
     }
 
@@ -534,15 +624,21 @@ void MultiLevelSetup<Matrix>::addHighDegreeSeedNodes(const Matrix &matrix,
 template <class Matrix>
 void MultiLevelSetup<Matrix>::aggregateLooseNodes(const Matrix &strongAdjMatrix,
                                                   std::vector<index> &status, count &nc) const {
-    std::vector<index> looseNodes;
-    for (index i = 0; i < strongAdjMatrix.numberOfRows(); ++i) {
+    std::vector<uint8_t> loose(strongAdjMatrix.numberOfRows());
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(strongAdjMatrix.numberOfRows()); ++i) {
         double max = std::numeric_limits<double>::min();
         strongAdjMatrix.forNonZeroElementsInRow(i, [&](index /*j*/, double value) {
             if (value > max)
                 max = value;
         });
 
-        if (std::abs(max) < 1e-9 || max == std::numeric_limits<double>::min()) {
+        loose[i] = std::abs(max) < 1e-9 || max == std::numeric_limits<double>::min();
+    }
+
+    std::vector<index> looseNodes;
+    for (index i = 0; i < strongAdjMatrix.numberOfRows(); ++i) {
+        if (loose[i]) {
             looseNodes.push_back(i);
         }
     }
@@ -704,7 +800,10 @@ void MultiLevelSetup<Matrix>::computeStrongNeighbors(const Matrix &affinityMatri
             }
         });
 
-    for (index i = 0; i < affinityMatrix.numberOfRows(); ++i) {
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(max : overallMax) reduction(min : overallMin)
+#endif // NETWORKIT_OMP2
+    for (omp_index i = 0; i < static_cast<omp_index>(affinityMatrix.numberOfRows()); ++i) {
         if (maxNeighbor[i] > overallMax) {
             overallMax = maxNeighbor[i];
         }
@@ -814,20 +913,34 @@ void MultiLevelSetup<Matrix>::galerkinOperator(const Matrix &P, const Matrix &A,
                                                const std::vector<index> &PColIndex,
                                                const std::vector<std::vector<index>> &PRowIndex,
                                                Matrix &B) const {
-    std::vector<Triplet> triplets;
-    SparseAccumulator spa(P.numberOfColumns());
-    for (index i = 0; i < P.numberOfColumns(); ++i) {
-        for (index k : PRowIndex[i]) {
-            double Pki = P(k, i);
-            A.forNonZeroElementsInRow(k, [&](index l, double value) {
-                index j = PColIndex[l];
-                spa.scatter(Pki * value * P(l, j), j);
+    // Each thread computes a contiguous range of rows of B; concatenating the results in thread
+    // order yields the triplets in row order.
+    std::vector<std::vector<Triplet>> threadTriplets(omp_get_max_threads());
+#pragma omp parallel
+    {
+        auto &triplets = threadTriplets[omp_get_thread_num()];
+        SparseAccumulator spa(P.numberOfColumns());
+#pragma omp for schedule(static)
+        for (omp_index i = 0; i < static_cast<omp_index>(P.numberOfColumns()); ++i) {
+            for (index k : PRowIndex[i]) {
+                double Pki = P(k, i);
+                A.forNonZeroElementsInRow(k, [&](index l, double value) {
+                    index j = PColIndex[l];
+                    spa.scatter(Pki * value * P(l, j), j);
+                });
+            }
+
+            spa.gather([&](index, index j, double value) {
+                triplets.push_back({static_cast<index>(i), j, value});
             });
-        }
 
-        spa.gather([&](index i, index j, double value) { triplets.push_back({i, j, value}); });
+            spa.increaseRow();
+        }
+    }
 
-        spa.increaseRow();
+    std::vector<Triplet> triplets;
+    for (const auto &part : threadTriplets) {
+        triplets.insert(triplets.end(), part.begin(), part.end());
     }
 
     B = Matrix(P.numberOfColumns(), P.numberOfColumns(), triplets);
@@ -937,23 +1050,58 @@ template <>
 inline void MultiLevelSetup<CSRMatrix>::galerkinOperator(
     const CSRMatrix &P, const CSRMatrix &A, const std::vector<index> &PColIndex,
     const std::vector<std::vector<index>> &PRowIndex, CSRMatrix &B) const {
-    std::vector<Triplet> triplets;
-    SparseAccumulator spa(P.numberOfColumns());
-    for (index i = 0; i < P.numberOfColumns(); ++i) {
-        for (index k : PRowIndex[i]) {
-            double Pki = P(k, i);
-            A.forNonZeroElementsInRow(k, [&](index l, double value) {
-                index j = PColIndex[l];
-                spa.scatter(Pki * value * P(l, j), j);
-            });
+    const count nc = P.numberOfColumns();
+    std::vector<index> rowIdx(nc + 1, 0);
+    std::vector<index> columnIdx;
+    std::vector<double> nonZeros;
+
+    // Two passes over the rows of B: the first one determines the sparsity pattern, the second one
+    // writes the values directly into the CSR arrays.
+#pragma omp parallel
+    {
+        SparseAccumulator spa(nc);
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(nc); ++i) {
+            for (index k : PRowIndex[i]) {
+                A.forNonZeroElementsInRow(
+                    k, [&](index l, double /*value*/) { spa.scatter(0.0, PColIndex[l]); });
+            }
+
+            rowIdx[i + 1] = spa.gather([](index, index, double) {});
+            spa.increaseRow();
+        }
+
+#pragma omp single
+        {
+            for (index i = 0; i < nc; ++i)
+                rowIdx[i + 1] += rowIdx[i];
+
+            columnIdx.resize(rowIdx[nc]);
+            nonZeros.resize(rowIdx[nc]);
         }
 
-        spa.gather([&](index i, index j, double value) { triplets.push_back({i, j, value}); });
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(nc); ++i) {
+            for (index k : PRowIndex[i]) {
+                double Pki = P(k, i);
+                A.forNonZeroElementsInRow(k, [&](index l, double value) {
+                    index j = PColIndex[l];
+                    spa.scatter(Pki * value * P(l, j), j);
+                });
+            }
+
+            index pos = rowIdx[i];
+            spa.gather([&](index, index j, double value) {
+                columnIdx[pos] = j;
+                nonZeros[pos] = value;
+                ++pos;
+            });
 
-        spa.increaseRow();
+            spa.increaseRow();
+        }
     }
 
-    B = CSRMatrix(P.numberOfColumns(), P.numberOfColumns(), triplets, 0.0, true);
+    B = CSRMatrix(nc, nc, rowIdx, columnIdx, nonZeros, 0.0, true);
 }
 
 template <>
@@ -962,20 +1110,7 @@ inline void MultiLevelSetup<CSRMatrix>::eliminationOperators(const CSRMatrix &ma
                                                              const std::vector<index> &coarseIndex,
                                                              CSRMatrix &P, Vector &q) const {
     std::vector<Triplet> triples;
-    q = Vector(fSet.size());
-    for (index k = 0; k < fSet.size(); ++k) { // Afc
-        matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
-            if (fSet[k] == j) {
-                q[k] = 1.0 / w;
-            } else {
-                triples.push_back({k, coarseIndex[j], w});
-            }
-        });
-    }
-
-    for (index i = 0; i < triples.size(); ++i) { // * -Aff^-1
-        triples[i].value *= -q[triples[i].row];
-    }
+    eliminationTriplets(matrix, fSet, coarseIndex, triples, q);
 
     P = CSRMatrix(fSet.size(), coarseIndex.size() - fSet.size(), triples, 0.0, matrix.sorted());
 }
@@ -1039,7 +1174,8 @@ inline void MultiLevelSetup<CSRMatrix>::coarseningAggregation(CSRMatrix &matrix,
         }
     }
 
-    for (index i = 0; i < matrix.numberOfRows(); ++i) {
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
         if (S[bestAggregate][i] == UNDECIDED) { // undediced nodes become their own seeds
             S[bestAggregate][i] = i;
         }
@@ -1053,7 +1189,8 @@ inline void MultiLevelSetup<CSRMatrix>::coarseningAggregation(CSRMatrix &matrix,
         }
     }
 
-    for (index i = 0; i < matrix.numberOfRows(); ++i) {
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
         status[i] = indexFine[S[bestAggregate][i]];
     }
 
@@ -1065,10 +1202,14 @@ inline void MultiLevelSetup<CSRMatrix>::coarseningAggregation(CSRMatrix &matrix,
     std::vector<index> PColIndex(matrix.numberOfRows());
     std::vector<std::vector<index>> PRowIndex(nc[bestAggregate]);
 
-    for (index i = 0; i < matrix.numberOfRows(); ++i) {
-        pTriples[i] = {i, status[i], 1};
-        rTriples[i] = {status[i], i, 1};
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
+        pTriples[i] = {static_cast<index>(i), status[i], 1};
+        rTriples[i] = {status[i], static_cast<index>(i), 1};
         PColIndex[i] = status[i];
+    }
+
+    for (index i = 0; i < matrix.numberOfRows(); ++i) {
         PRowIndex[status[i]].push_back(i);
     }
 
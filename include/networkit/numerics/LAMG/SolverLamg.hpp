@@ -9,6 +9,7 @@
 #define NETWORKIT_NUMERICS_LAMG_SOLVER_LAMG_HPP_
 
 #include <cmath>
+#include <numeric>
 #include <vector>
 
 #include <networkit/algebraic/DenseMatrix.hpp>
@@ -63,8 +64,24 @@ private:
                std::vector<Vector> &X, std::vector<Vector> &B, const LAMGSolverStatus &status);
     void saveIterate(index level, const Vector &x, const Vector &r);
     void clearHistory(index level);
+    void resetHistory();
     void minRes(index level, Vector &x, const Vector &r) const;
 
+    // Block versions of solveCycle and cycle: the cycles of all systems run in lockstep, each
+    // system keeps its iterate history in its own solver in systems[ids[i]].
+    void solveBlockCycle(std::vector<Vector> &x, const std::vector<Vector> &b, int finest,
+                         std::vector<LAMGSolverStatus> &status);
+    void blockCycle(std::vector<Vector> &x, const std::vector<Vector> &b, int finest, int coarsest,
+                    std::vector<count> &numVisits, std::vector<std::vector<Vector>> &X,
+                    std::vector<std::vector<Vector>> &B, std::vector<Vector> &R,
+                    std::vector<std::vector<std::vector<Vector>>> &stages,
+                    std::vector<SolverLamg> &systems, const std::vector<index> &ids,
+                    const LAMGSolverStatus &status) const;
+
+    // R[i] = B[i] - A * X[i] for all systems with one pass over A.
+    static void blockResidual(const Matrix &A, const std::vector<Vector> &X,
+                              const std::vector<Vector> &B, std::vector<Vector> &R);
+
 public:
     /**
      * Constructs a new solver instance for the specified @a hierarchy. The @a smoother will be used
@@ -96,6 +113,20 @@ public:
      * @param status Reference to an LAMGSolverStatus.
      */
     void solve(Vector &x, const Vector &b, LAMGSolverStatus &status);
+
+    /**
+     * Solves the systems A*x[i] = b[i] for all right-hand sides in @a b simultaneously. The cycles
+     * of the systems run in lockstep, so that each relaxation and residual computation streams the
+     * matrix of a level only once for the whole block. Every system keeps its own iterate history
+     * and stopping criteria from @a status[i] and leaves the block as soon as it has finished. The
+     * smoothing parameters are taken from @a status[0].
+     * @param x[out] The initial guesses to the solutions and the approximations after the solver
+     * finished.
+     * @param b The right-hand side vectors.
+     * @param status One LAMGSolverStatus for each system.
+     */
+    void solveBlock(std::vector<Vector> &x, const std::vector<Vector> &b,
+                    std::vector<LAMGSolverStatus> &status);
 };
 
 template <class Matrix>
@@ -138,23 +169,12 @@ void SolverLamg<Matrix>::solveCycle(Vector &x, const Vector &b, const int finest
     Aux::Timer timer;
     timer.start();
 
-    // data structures for iterate recombination
-    history = std::vector<std::vector<Vector>>(hierarchy.size());
-    rHistory = std::vector<std::vector<Vector>>(hierarchy.size());
-    latestIterate = std::vector<index>(hierarchy.size(), 0);
-    numActiveIterates = std::vector<count>(hierarchy.size(), 0);
+    resetHistory();
     int coarsest = hierarchy.size() - 1;
     std::vector<count> numVisits(coarsest);
     std::vector<Vector> X(hierarchy.size());
     std::vector<Vector> B(hierarchy.size());
 
-    for (index i = 0; i < hierarchy.size(); ++i) {
-        history[i] =
-            std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
-        rHistory[i] =
-            std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
-    }
-
     Vector r = b - hierarchy.at(finest).getLaplacian() * x;
     double residual = r.length();
     double finalResidual = residual * status.desiredResidualReduction;
@@ -181,8 +201,8 @@ void SolverLamg<Matrix>::solveCycle(Vector &x, const Vector &b, const int finest
     timer.stop();
 
     status.numIters = iterations;
-    status.residual = r.length();
-    status.converged = r.length() <= finalResidual;
+    status.residual = residual;
+    status.converged = residual <= finalResidual;
 }
 
 template <class Matrix>
@@ -289,6 +309,298 @@ void SolverLamg<Matrix>::cycle(Vector &x, const Vector &b, const int finest, con
     x = X[finest];
 }
 
+template <class Matrix>
+void SolverLamg<Matrix>::solveBlock(std::vector<Vector> &x, const std::vector<Vector> &b,
+                                    std::vector<LAMGSolverStatus> &status) {
+    assert(x.size() == b.size() && b.size() == status.size());
+    const count k = b.size();
+    if (k == 0)
+        return;
+
+    if (hierarchy.size() >= 2) {
+        std::vector<Vector> bc = b;
+        std::vector<Vector> xc = x;
+        int finest = 0;
+
+        // bStages of the elimination of the finest level, one for each system
+        std::vector<std::vector<Vector>> finestStages(k);
+        if (hierarchy.getType(1) == ELIMINATION) {
+            if (hierarchy.at(1).getLaplacian().numberOfRows() == 1) {
+                for (auto &xi : x)
+                    xi = 0.0;
+                return;
+            }
+            for (index i = 0; i < k; ++i) {
+                hierarchy.at(1).restrict(b[i], bc[i], finestStages[i]);
+                hierarchy.at(1).coarseType(x[i], xc[i]);
+            }
+            finest = 1;
+        }
+        solveBlockCycle(xc, bc, finest, status);
+
+        // interpolate from finest == ELIMINATION level back to actual finest level
+        for (index i = 0; i < k; ++i) {
+            if (finest == 1) {
+                hierarchy.at(1).interpolate(xc[i], x[i], finestStages[i]);
+            } else {
+                x[i] = std::move(xc[i]);
+            }
+        }
+    } else {
+        solveBlockCycle(x, b, 0, status);
+    }
+
+    std::vector<Vector> r;
+    blockResidual(hierarchy.at(0).getLaplacian(), x, b, r);
+    for (index i = 0; i < k; ++i)
+        status[i].residual = r[i].length();
+}
+
+template <class Matrix>
+void SolverLamg<Matrix>::solveBlockCycle(std::vector<Vector> &x, const std::vector<Vector> &b,
+                                         const int finest, std::vector<LAMGSolverStatus> &status) {
+    Aux::Timer timer;
+    timer.start();
+
+    const count k = b.size();
+    const Matrix &A = hierarchy.at(finest).getLaplacian();
+    int coarsest = hierarchy.size() - 1;
+    std::vector<count> numVisits(coarsest);
+    std::vector<std::vector<Vector>> X(hierarchy.size());
+    std::vector<std::vector<Vector>> B(hierarchy.size());
+    std::vector<std::vector<std::vector<Vector>>> stages(hierarchy.size());
+    std::vector<Vector> R;
+
+    std::vector<SolverLamg> systems(k, SolverLamg(hierarchy, smoother));
+    for (auto &system : systems)
+        system.resetHistory();
+
+    // The unfinished systems: ids[i] is the system whose iterate and right-hand side are stored in
+    // xs[i] and bs[i].
+    std::vector<index> ids(k);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::vector<Vector> xs = x;
+    std::vector<Vector> bs = b;
+
+    std::vector<double> residual(k), finalResidual(k);
+    std::vector<double> bestResidual(k, std::numeric_limits<double>::max());
+    std::vector<count> noResReduction(k, 0);
+
+    blockResidual(A, xs, bs, R);
+    for (index i = 0; i < k; ++i) {
+        residual[i] = R[i].length();
+        finalResidual[i] = residual[i] * status[i].desiredResidualReduction;
+        status[i].residualHistory.emplace_back(residual[i]);
+        status[i].numIters = 0;
+    }
+
+    // Moves the finished systems out of the block.
+    const auto retireFinished = [&]() {
+        for (index i = 0; i < ids.size();) {
+            const index id = ids[i];
+            if (residual[id] > finalResidual[id] && noResReduction[id] < 5
+                && status[id].numIters < status[id].maxIters
+                && timer.elapsedMilliseconds() <= status[id].maxConvergenceTime) {
+                ++i;
+                continue;
+            }
+
+            x[id] = std::move(xs[i]);
+            status[id].residual = residual[id];
+            status[id].converged = residual[id] <= finalResidual[id];
+
+            ids[i] = ids.back();
+            ids.pop_back();
+            xs[i] = std::move(xs.back());
+            xs.pop_back();
+            bs[i] = std::move(bs.back());
+            bs.pop_back();
+        }
+    };
+
+    retireFinished();
+    while (!ids.empty()) {
+        blockCycle(xs, bs, finest, coarsest, numVisits, X, B, R, stages, systems, ids, status[0]);
+        blockResidual(A, xs, bs, R);
+        for (index i = 0; i < ids.size(); ++i) {
+            const index id = ids[i];
+            residual[id] = R[i].length();
+            status[id].residualHistory.emplace_back(residual[id]);
+            if (residual[id] < bestResidual[id]) {
+                noResReduction[id] = 0;
+                bestResidual[id] = residual[id];
+            } else {
+                ++noResReduction[id];
+            }
+            status[id].numIters++;
+        }
+        retireFinished();
+    }
+
+    timer.stop();
+}
+
+template <class Matrix>
+void SolverLamg<Matrix>::blockCycle(std::vector<Vector> &x, const std::vector<Vector> &b,
+                                    const int finest, const int coarsest,
+                                    std::vector<count> &numVisits,
+                                    std::vector<std::vector<Vector>> &X,
+                                    std::vector<std::vector<Vector>> &B, std::vector<Vector> &R,
+                                    std::vector<std::vector<std::vector<Vector>>> &stages,
+                                    std::vector<SolverLamg> &systems,
+                                    const std::vector<index> &ids,
+                                    const LAMGSolverStatus &status) const {
+    // The control flow only depends on the hierarchy, see cycle() for the single-vector version.
+    const count k = x.size();
+    std::fill(numVisits.begin(), numVisits.end(), 0);
+    X[finest] = x;
+    B[finest] = b;
+    for (index level = finest + 1; level < hierarchy.size(); ++level) {
+        X[level].resize(k);
+        B[level].resize(k);
+        stages[level].resize(k);
+    }
+
+    int currLvl = finest;
+    int nextLvl = finest;
+    double maxVisits = 0.0;
+
+    const auto laplacian = [&](int level) -> const Matrix & {
+        return hierarchy.at(level).getLaplacian();
+    };
+
+    blockResidual(laplacian(currLvl), X[currLvl], B[currLvl], R);
+    for (index i = 0; i < k; ++i)
+        systems[ids[i]].saveIterate(currLvl, X[currLvl][i], R[i]);
+    while (true) {
+        if (currLvl == coarsest) {
+            nextLvl = currLvl - 1;
+            if (currLvl == finest) { // finest level
+                smoother.blockRelax(laplacian(currLvl), B[currLvl], X[currLvl],
+                                    status.numPreSmoothIters);
+            } else {
+                for (index i = 0; i < k; ++i) {
+                    Vector bCoarse(B[currLvl][i].getDimension() + 1, 0.0);
+                    for (index j = 0; j < B[currLvl][i].getDimension(); ++j) {
+                        bCoarse[j] = B[currLvl][i][j];
+                    }
+
+                    Vector xCoarse = DenseMatrix::LUSolve(hierarchy.getCoarseMatrix(), bCoarse);
+                    for (index j = 0; j < X[currLvl][i].getDimension(); ++j) {
+                        X[currLvl][i][j] = xCoarse[j];
+                    }
+                }
+            }
+        } else {
+            if (currLvl == finest) {
+                maxVisits = 1.0;
+            } else {
+                maxVisits = hierarchy.cycleIndex(currLvl) * numVisits[currLvl - 1];
+            }
+
+            if (numVisits[currLvl] < static_cast<count>(maxVisits)) {
+                nextLvl = currLvl + 1;
+            } else {
+                nextLvl = currLvl - 1;
+            }
+        }
+
+        if (nextLvl < finest)
+            break;
+
+        if (nextLvl > currLvl) { // preProcess
+            numVisits[currLvl]++;
+
+            if (hierarchy.getType(nextLvl) != ELIMINATION) {
+                smoother.blockRelax(laplacian(currLvl), B[currLvl], X[currLvl],
+                                    status.numPreSmoothIters);
+            }
+
+            if (hierarchy.getType(nextLvl) == ELIMINATION) {
+                for (index i = 0; i < k; ++i)
+                    hierarchy.at(nextLvl).restrict(B[currLvl][i], B[nextLvl][i],
+                                                   stages[nextLvl][i]);
+            } else {
+                blockResidual(laplacian(currLvl), X[currLvl], B[currLvl], R);
+                for (index i = 0; i < k; ++i)
+                    hierarchy.at(nextLvl).restrict(R[i], B[nextLvl][i]);
+            }
+
+            for (index i = 0; i < k; ++i) {
+                hierarchy.at(nextLvl).coarseType(X[currLvl][i], X[nextLvl][i]);
+                systems[ids[i]].clearHistory(nextLvl);
+            }
+        } else { // postProcess
+            if (currLvl == coarsest || hierarchy.getType(currLvl + 1) != ELIMINATION) {
+                blockResidual(laplacian(currLvl), X[currLvl], B[currLvl], R);
+                for (index i = 0; i < k; ++i)
+                    systems[ids[i]].minRes(currLvl, X[currLvl][i], R[i]);
+            }
+
+            if (nextLvl > finest) {
+                blockResidual(laplacian(nextLvl), X[nextLvl], B[nextLvl], R);
+                for (index i = 0; i < k; ++i)
+                    systems[ids[i]].saveIterate(nextLvl, X[nextLvl][i], R[i]);
+            }
+
+            for (index i = 0; i < k; ++i) {
+                if (hierarchy.getType(currLvl) == ELIMINATION) {
+                    hierarchy.at(currLvl).interpolate(X[currLvl][i], X[nextLvl][i],
+                                                      stages[currLvl][i]);
+                } else {
+                    Vector xf = X[nextLvl][i];
+                    hierarchy.at(currLvl).interpolate(X[currLvl][i], xf);
+                    X[nextLvl][i] += xf;
+                }
+            }
+
+            if (hierarchy.getType(currLvl) != ELIMINATION) {
+                smoother.blockRelax(laplacian(nextLvl), B[nextLvl], X[nextLvl],
+                                    status.numPostSmoothIters);
+            }
+        }
+
+        currLvl = nextLvl;
+    } // while
+
+    // post-cycle finest
+    if ((int64_t)hierarchy.size() > finest + 1 && hierarchy.getType(finest + 1) != ELIMINATION) {
+        // Do an iterate recombination on calculated solutions
+        blockResidual(laplacian(finest), X[finest], B[finest], R);
+        for (index i = 0; i < k; ++i)
+            systems[ids[i]].minRes(finest, X[finest][i], R[i]);
+    }
+
+    for (index i = 0; i < k; ++i) {
+        X[finest][i] -= X[finest][i].mean();
+        x[i] = X[finest][i];
+    }
+}
+
+template <class Matrix>
+void SolverLamg<Matrix>::blockResidual(const Matrix &A, const std::vector<Vector> &X,
+                                       const std::vector<Vector> &B, std::vector<Vector> &R) {
+    const count k = X.size();
+    const count n = A.numberOfRows();
+    R.resize(k);
+    for (auto &r : R) {
+        if (r.getDimension() != n)
+            r = Vector(n);
+    }
+
+    std::vector<double> product(k);
+    for (index i = 0; i < n; ++i) {
+        std::fill(product.begin(), product.end(), 0.0);
+        A.forNonZeroElementsInRow(i, [&](index column, double value) {
+            for (index j = 0; j < k; ++j)
+                product[j] += value * X[j][column];
+        });
+
+        for (index j = 0; j < k; ++j)
+            R[j][i] = B[j][i] - product[j];
+    }
+}
+
 template <class Matrix>
 void SolverLamg<Matrix>::saveIterate(const index level, const Vector &x, const Vector &r) {
     // update latest pointer
@@ -311,6 +623,22 @@ void SolverLamg<Matrix>::clearHistory(const index level) {
     numActiveIterates[level] = 0;
 }
 
+template <class Matrix>
+void SolverLamg<Matrix>::resetHistory() {
+    // data structures for iterate recombination
+    history = std::vector<std::vector<Vector>>(hierarchy.size());
+    rHistory = std::vector<std::vector<Vector>>(hierarchy.size());
+    latestIterate = std::vector<index>(hierarchy.size(), 0);
+    numActiveIterates = std::vector<count>(hierarchy.size(), 0);
+
+    for (index i = 0; i < hierarchy.size(); ++i) {
+        history[i] =
+            std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
+        rHistory[i] =
+            std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
+    }
+}
+
 } /* namespace NetworKit */
 
 #endif // NETWORKIT_NUMERICS_LAMG_SOLVER_LAMG_HPP_
@@ -52,6 +52,20 @@ public:
         return out;
     }
 
+    /**
+     * Computes the preconditioned right-hand sides of the @a k vectors of dimension @a n stored
+     * row-major in @a b (entry i of vector c at b[i * k + c]) and writes them to @a out in the same
+     * layout. @a out may be equal to @a b.
+     */
+    void rhs(const double *b, double *out, count n, count k) const {
+        assert(n == inv_diag.getDimension());
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+            for (index c = 0; c < k; ++c)
+                out[i * k + c] = inv_diag[i] * b[i * k + c];
+        }
+    }
+
 private:
     Vector inv_diag;
 };
@@ -8,6 +8,10 @@
 #ifndef NETWORKIT_NUMERICS_PRECONDITIONER_IDENTITY_PRECONDITIONER_HPP_
 #define NETWORKIT_NUMERICS_PRECONDITIONER_IDENTITY_PRECONDITIONER_HPP_
 
+#include <algorithm>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
+
 namespace NetworKit {
 
 /**
@@ -29,6 +33,15 @@ public:
      * Returns the preconditioned right-hand-side \f$P(b) = b\f$.
      */
     Vector rhs(const Vector &b) const { return b; }
+
+    /**
+     * Copies the @a k vectors of dimension @a n stored row-major in @a b to @a out, which may be
+     * equal to @a b.
+     */
+    void rhs(const double *b, double *out, count n, count k) const {
+        if (b != out)
+            std::copy(b, b + n * k, out);
+    }
 };
 
 } /* namespace NetworKit */
@@ -12,6 +12,7 @@
 #include <networkit/algebraic/Vector.hpp>
 
 #include <limits>
+#include <vector>
 #include <networkit/algebraic/DynamicMatrix.hpp>
 
 namespace NetworKit {
@@ -30,6 +31,17 @@ public:
                          count maxIterations = std::numeric_limits<count>::max()) const = 0;
     virtual Vector relax(const Matrix &A, const Vector &b,
                          count maxIterations = std::numeric_limits<count>::max()) const = 0;
+
+    /**
+     * Relaxes the systems A * X[i] = B[i] for all right-hand sides in @a B, starting with the
+     * initial guesses in @a X, which are overwritten by the results. The default implementation
+     * relaxes the systems one after another.
+     */
+    virtual void blockRelax(const Matrix &A, const std::vector<Vector> &B, std::vector<Vector> &X,
+                            count maxIterations = std::numeric_limits<count>::max()) const {
+        for (index i = 0; i < B.size(); ++i)
+            X[i] = relax(A, B[i], X[i], maxIterations);
+    }
 };
 
 } /* namespace NetworKit */
@@ -32,9 +32,21 @@ public:
         throw std::runtime_error("run() is not supported by this algorithm; use run(trades)");
     };
 
-    /* The algorithm is not parallel. */
+    /**
+     * Carries out the trades in the given order. If more than one thread is available, maximal
+     * runs of consecutive trades that involve distinct, pairwise non-adjacent nodes are carried
+     * out in parallel. Such trades commute, so the result is distributed as if all trades had
+     * been carried out one after another. The parallel execution is not reproducible from the
+     * seed of Aux::Random, as the random choices of a trade depend on the thread it runs on.
+     */
     void run(const std::vector<std::pair<node, node>> &trades);
 
+    /**
+     * If set to false, the trades are carried out one after another by a single thread, so that
+     * the result only depends on the seed of Aux::Random. Default: true.
+     */
+    void setParallel(bool parallel);
+
     Graph getGraph(bool parallel = false);
 
     count getNumberOfAffectedEdges() const;
@@ -8,9 +8,9 @@
 #ifndef NETWORKIT_RANDOMIZATION_EDGE_SWITCHING_HPP_
 #define NETWORKIT_RANDOMIZATION_EDGE_SWITCHING_HPP_
 
-#include <random>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <networkit/Globals.hpp>
 #include <networkit/base/Algorithm.hpp>
@@ -38,6 +38,13 @@ namespace NetworKit {
  *
  * It's recommended to implement the preprocessing step in the calling code or to use copying
  * EdgeSwitching implementation.
+ *
+ * The switches are carried out in parallel. A switch locks the (at most four) endpoints of its
+ * edges before it checks for multi-edges and exchanges the endpoints, so concurrent switches
+ * never read or modify the same neighborhood, and each switch sees a consistent graph.
+ *
+ * @note In parallel, the result depends on the scheduling of the threads and is not
+ * reproducible from the seed of Aux::Random. Use setParallel(false) if it has to be.
  */
 class EdgeSwitchingInPlace : public Algorithm {
 public:
@@ -76,13 +83,21 @@ public:
     /// Modify (average) number of switches per edge that will be executed on next run
     void setNumberOfSwitchesPerEdge(double x);
 
+    /**
+     * If set to false, the switches are carried out by a single thread, so that the result only
+     * depends on the seed of Aux::Random. Default: true.
+     */
+    void setParallel(bool parallel) noexcept { this->parallel = parallel; }
+
 protected:
     Graph &graph;
-    std::discrete_distribution<node>
-        degreeDistribution; ///< Return node x with probability proportional to degree(x)
+    /// The i-th edge is the (i - degreePrefixSum[x])-th edge of the node x with
+    /// degreePrefixSum[x] <= i < degreePrefixSum[x + 1]
+    std::vector<edgeid> degreePrefixSum;
 
     double numberOfSwitchesPerEdge;
     count numberOfSwapsPerformed{0};
+    bool parallel{true};
 };
 
 /**
@@ -105,6 +120,9 @@ protected:
  *
  * It's recommended to implement the preprocessing step in the calling code or to use copying
  * EdgeSwitching implementation.
+ *
+ * The switches are carried out in parallel, see EdgeSwitchingInPlace; use setParallel(false)
+ * for results that are reproducible from the seed of Aux::Random.
  */
 class EdgeSwitching : public Algorithm {
 public:
@@ -146,6 +164,9 @@ public:
     /// Modify (average) number of switches per edge that will be executed on next run
     void setNumberOfSwitchesPerEdge(double x) { inPlaceAlgorithm.setNumberOfSwitchesPerEdge(x); }
 
+    /// See EdgeSwitchingInPlace::setParallel()
+    void setParallel(bool parallel) noexcept { inPlaceAlgorithm.setParallel(parallel); }
+
 private:
     Graph ownedGraph;
     EdgeSwitchingInPlace inPlaceAlgorithm;
@@ -0,0 +1,245 @@
+/*
+ * CompactCover.hpp
+ */
+
+#ifndef NETWORKIT_STRUCTURES_COMPACT_COVER_HPP_
+#define NETWORKIT_STRUCTURES_COMPACT_COVER_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/structures/Cover.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup structures
+ * Immutable cover of a set, i.e. an assignment of its elements to possibly overlapping subsets.
+ * Unlike Cover, which keeps a std::set per element, the subset ids of all elements are stored
+ * in a single array (CSR layout) where the ids of each element are sorted. This needs 8 bytes per
+ * membership plus 8 bytes per element, and membership tests and intersections run on contiguous
+ * memory. Use CompactCoverBuilder to construct a CompactCover from scratch.
+ */
+class CompactCover final {
+    friend class CompactCoverBuilder;
+
+public:
+    using const_iterator = std::vector<index>::const_iterator;
+
+    /** Default constructor */
+    CompactCover() = default;
+
+    /**
+     * Creates a compact copy of the cover @a C.
+     *
+     * @param[in] C The cover.
+     */
+    explicit CompactCover(const Cover &C);
+
+    /**
+     * Creates a compact cover which contains the given partition.
+     *
+     * @param[in] P The partition.
+     */
+    explicit CompactCover(const Partition &P);
+
+    /**
+     * Iterator to the first (i.e., smallest) subset id of element @a e.
+     */
+    const_iterator subsetsBegin(index e) const {
+        assert(e < numberOfElements());
+        return subsets.begin() + static_cast<std::ptrdiff_t>(offsets[e]);
+    }
+
+    /**
+     * Iterator past the last subset id of element @a e.
+     */
+    const_iterator subsetsEnd(index e) const {
+        assert(e < numberOfElements());
+        return subsets.begin() + static_cast<std::ptrdiff_t>(offsets[e + 1]);
+    }
+
+    /**
+     * Return the (sorted) ids of subsets in which the element @a e is contained.
+     */
+    std::vector<index> subsetsOf(index e) const { return {subsetsBegin(e), subsetsEnd(e)}; }
+
+    /**
+     * Return the number of subsets that contain the element @a e.
+     */
+    count numberOfSubsetsOf(index e) const {
+        assert(e < numberOfElements());
+        return offsets[e + 1] - offsets[e];
+    }
+
+    /**
+     * Check if the element @a e is assigned to at least one subset.
+     */
+    bool contains(index e) const { return e < numberOfElements() && numberOfSubsetsOf(e) > 0; }
+
+    /**
+     * Check if the element @a e is contained in subset @a s.
+     */
+    bool isInSubset(index e, index s) const {
+        return std::binary_search(subsetsBegin(e), subsetsEnd(e), s);
+    }
+
+    /**
+     * Check if two elements @a e1 and @a e2 belong to the same subset.
+     */
+    bool inSameSubset(index e1, index e2) const;
+
+    /**
+     * Return the number of subsets that contain both @a e1 and @a e2.
+     */
+    count numberOfCommonSubsets(index e1, index e2) const;
+
+    /**
+     * Get the (sorted) members of subset @a s.
+     */
+    std::vector<index> getMembers(index s) const;
+
+    /**
+     * Get an upper bound for the subset ids that have been assigned (the maximum id + 1).
+     */
+    index upperBound() const noexcept { return upper; }
+
+    /**
+     * Get a lower bound for the subset ids that have been assigned.
+     */
+    index lowerBound() const noexcept { return 0; }
+
+    /**
+     * Get a list of subset sizes, indexed by subset id. Unused ids have size 0.
+     */
+    std::vector<count> subsetSizes() const;
+
+    /**
+     * Get a map from subset id to size of the (nonempty) subset.
+     */
+    std::map<index, count> subsetSizeMap() const;
+
+    /**
+     * Get the number of nonempty subsets.
+     */
+    count numberOfSubsets() const;
+
+    /**
+     * Get the number of elements.
+     */
+    count numberOfElements() const noexcept { return offsets.size() - 1; }
+
+    /**
+     * Get the total number of (element, subset) memberships.
+     */
+    count numberOfMemberships() const noexcept { return subsets.size(); }
+
+    /**
+     * Converts this cover into a Cover.
+     */
+    Cover toCover() const;
+
+    /**
+     * Iterate over all entries (element, subset id) and execute callback function @a handle.
+     *
+     * @param handle Takes parameters <code>(index, index)</code>
+     */
+    template <typename Callback>
+    void forEntries(Callback handle) const;
+
+    /**
+     * Iterate over all elements in parallel and execute callback function @a handle for all
+     * entries (element, subset id).
+     *
+     * @param handle Takes parameters <code>(index, index)</code>
+     */
+    template <typename Callback>
+    void parallelForEntries(Callback handle) const;
+
+private:
+    //! subsets of element e are stored in [offsets[e], offsets[e+1])
+    std::vector<index> offsets{0};
+    std::vector<index> subsets; //!< subset ids, sorted per element
+    index upper = 1;            //!< upper bound of the subset ids (as in Cover)
+};
+
+/**
+ * @ingroup structures
+ * Collects the memberships of a CompactCover. Memberships can be added concurrently from any
+ * number of threads, also from nested parallel regions; each thread appends to its own buffer,
+ * which is created on its first insertion. Duplicates are removed by build().
+ */
+class CompactCoverBuilder final {
+public:
+    /**
+     * @param[in] n Number of elements of the cover.
+     */
+    CompactCoverBuilder(count n);
+
+    /**
+     * Adds the element @a e to subset @a s. Thread-safe.
+     */
+    void addToSubset(index s, index e) {
+        assert(e < n);
+        localMemberships().emplace_back(e, s);
+    }
+
+    /**
+     * Builds the cover in parallel and resets the builder.
+     */
+    CompactCover build();
+
+private:
+    using Memberships = std::vector<std::pair<index, index>>; //!< (element, subset) pairs
+
+    // Buffers of the builders that the calling thread has recently inserted into, identified
+    // by the id of the builder.
+    struct LocalBuffers {
+        static constexpr count size = 4;
+        uint64_t ids[size] = {};
+        Memberships *buffers[size] = {};
+        index next = 0;
+    };
+    static thread_local LocalBuffers localBuffers;
+
+    count n;
+    uint64_t id; //!< unique over all builders, changes when the buffers are consumed by build()
+    std::mutex bufferMutex;
+    std::vector<std::unique_ptr<Memberships>> memberships;
+
+    Memberships &localMemberships() {
+        for (index i = 0; i < LocalBuffers::size; ++i)
+            if (localBuffers.ids[i] == id)
+                return *localBuffers.buffers[i];
+        return newLocalMemberships();
+    }
+
+    Memberships &newLocalMemberships();
+};
+
+template <typename Callback>
+void CompactCover::forEntries(Callback handle) const {
+    for (index e = 0; e < numberOfElements(); ++e)
+        for (index i = offsets[e]; i < offsets[e + 1]; ++i)
+            handle(e, subsets[i]);
+}
+
+template <typename Callback>
+void CompactCover::parallelForEntries(Callback handle) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index e = 0; e < static_cast<omp_index>(numberOfElements()); ++e)
+        for (index i = offsets[e]; i < offsets[e + 1]; ++i)
+            handle(static_cast<index>(e), subsets[i]);
+}
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_STRUCTURES_COMPACT_COVER_HPP_
@@ -8,7 +8,9 @@
 #ifndef NETWORKIT_VIZ_OCTREE_HPP_
 #define NETWORKIT_VIZ_OCTREE_HPP_
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <vector>
 
 #include <networkit/algebraic/Vector.hpp>
@@ -294,12 +296,24 @@ private:
     count dimensions;
     count numChildrenPerNode;
 
+    // The subtrees of this many levels below the root are built in parallel, if they contain
+    // at least minPointsPerTask points.
+    static constexpr count parallelLevels = 2;
+    static constexpr count minPointsPerTask = 1 << 12;
+
     /**
      * Batch insertion of points in @a points into the octree.
      * @param[in] points Points to be inserted into the octree as initialization.
      */
     void batchInsert(const std::vector<Vector> &points);
 
+    /**
+     * Adds the points with indices @a ids to the subtree rooted at @a node. Must be called from
+     * a single thread of a parallel region, unless NETWORKIT_OMP2 is defined.
+     */
+    void insertPoints(OctreeNode<T> &node, const std::vector<Point<T>> &points,
+                      const std::vector<index> &ids, count levels);
+
     std::vector<std::pair<count, Point<T>>>
     approximateDistance(const OctreeNode<T> &node, const Point<T> &p, double theta) const;
     void approximateDistance(const OctreeNode<T> &node, const Point<T> &p, double theta,
@@ -325,36 +339,96 @@ void Octree<T>::recomputeTree(const std::vector<Vector> &points) {
 
 template <typename T>
 void Octree<T>::batchInsert(const std::vector<Vector> &points) {
+    const count n = points[0].getDimension();
     Point<T> center(dimensions);
     T sideLength = 0;
     for (count d = 0; d < dimensions; ++d) {
         T minVal = points[d][0];
         T maxVal = points[d][0];
 
-        for (index i = 1; i < points[d].getDimension(); ++i) {
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(min : minVal) reduction(max : maxVal)
+        for (omp_index i = 1; i < static_cast<omp_index>(n); ++i) {
             minVal = std::min(minVal, points[d][i]);
             maxVal = std::max(maxVal, points[d][i]);
         }
+#else
+        for (index i = 1; i < n; ++i) {
+            minVal = std::min(minVal, points[d][i]);
+            maxVal = std::max(maxVal, points[d][i]);
+        }
+#endif // NETWORKIT_OMP2
 
         sideLength =
             std::max(sideLength, std::fabs(maxVal - minVal) * 1.005); // add 0.5% to bounding box
         center[d] = (minVal + maxVal) / 2.0;
     }
 
-    root.bBox = {center, sideLength};
+    BoundingBox<T> bBox(center, sideLength);
+    root = OctreeNode<T>(bBox);
 
-    for (index i = 0; i < points[0].getDimension(); ++i) {
-        Point<T> p(points.size());
+    std::vector<Point<T>> pointsOfIndex(n);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+        Point<T> p(dimensions);
         for (count d = 0; d < dimensions; ++d) {
             p[d] = points[d][i];
         }
-
-        root.addPoint(p, dimensions, numChildrenPerNode);
+        pointsOfIndex[i] = std::move(p);
     }
 
+    std::vector<index> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel
+#pragma omp single
+#endif // NETWORKIT_OMP2
+    insertPoints(root, pointsOfIndex, ids, parallelLevels);
+
     root.computeCenterOfMass();
 }
 
+template <typename T>
+void Octree<T>::insertPoints(OctreeNode<T> &node, const std::vector<Point<T>> &points,
+                             const std::vector<index> &ids, count levels) {
+    if (levels == 0 || ids.size() < minPointsPerTask) {
+        for (const index i : ids) {
+            node.addPoint(points[i], dimensions, numChildrenPerNode);
+        }
+        return;
+    }
+
+    // Split eagerly so that the children can be built independently. The tree may differ from
+    // the one built by sequential insertion: addPoint() merges a point into a leaf if it lies
+    // within 1e-3 of the leaf's center of mass instead of splitting, so clusters of
+    // near-coincident points can end up in one leaf there but in separate leaves here. The
+    // weight and center of mass of this node are the same either way.
+    node.split(dimensions, numChildrenPerNode);
+    std::vector<std::vector<index>> idsOfChild(node.children.size());
+    for (const index i : ids) {
+        for (index c = 0; c < node.children.size(); ++c) {
+            if (node.children[c].contains(points[i])) {
+                idsOfChild[c].push_back(i);
+                break;
+            }
+        }
+        node.centerOfMass += points[i];
+    }
+    node.weight = ids.size();
+
+    // Without tasks (NETWORKIT_OMP2), the children are built one after another.
+    for (index c = 0; c < node.children.size(); ++c) {
+#ifndef NETWORKIT_OMP2
+#pragma omp task shared(node, points, idsOfChild)
+#endif // NETWORKIT_OMP2
+        insertPoints(node.children[c], points, idsOfChild[c], levels - 1);
+    }
+#ifndef NETWORKIT_OMP2
+#pragma omp taskwait
+#endif // NETWORKIT_OMP2
+}
+
 template <typename T>
 std::vector<std::pair<count, Point<T>>>
 Octree<T>::approximateDistance(const OctreeNode<T> &node, const Point<T> &p, double theta) const {
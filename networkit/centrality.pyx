@@ -179,6 +179,7 @@ cdef extern from "<networkit/centrality/ApproxBetweenness.hpp>":
 	cdef cppclass _ApproxBetweenness "NetworKit::ApproxBetweenness" (_Centrality):
 		_ApproxBetweenness(_Graph, double, double, double) except +
 		count numberOfSamples() except +
+		double samplesPerSecond() except +
 
 cdef class ApproxBetweenness(Centrality):
 	"""
@@ -215,11 +216,25 @@ cdef class ApproxBetweenness(Centrality):
 	def numberOfSamples(self):
 		return (<_ApproxBetweenness*>(self._this)).numberOfSamples()
 
+	def samplesPerSecond(self):
+		"""
+		samplesPerSecond()
+
+		Returns the number of path samples drawn per second in the last run.
+
+		Returns
+		-------
+		float
+			Sampling throughput of the last run.
+		"""
+		return (<_ApproxBetweenness*>(self._this)).samplesPerSecond()
+
 
 cdef extern from "<networkit/centrality/EstimateBetweenness.hpp>":
 
 	cdef cppclass _EstimateBetweenness"NetworKit::EstimateBetweenness" (_Centrality):
 		_EstimateBetweenness(_Graph, count, bool_t, bool_t) except +
+		double samplesPerSecond() except +
 
 cdef class EstimateBetweenness(Centrality):
 	""" 
@@ -250,6 +265,19 @@ cdef class EstimateBetweenness(Centrality):
 		self._G = G
 		self._this = new _EstimateBetweenness(G._this, nSamples, normalized, parallel)
 
+	def samplesPerSecond(self):
+		"""
+		samplesPerSecond()
+
+		Returns the number of sampled sources processed per second in the last run.
+
+		Returns
+		-------
+		float
+			Sampling throughput of the last run.
+		"""
+		return (<_EstimateBetweenness*>(self._this)).samplesPerSecond()
+
 cdef extern from "<networkit/centrality/KadabraBetweenness.hpp>":
 
 	cdef cppclass _KadabraBetweenness "NetworKit::KadabraBetweenness" (_Algorithm):
@@ -260,6 +288,7 @@ cdef extern from "<networkit/centrality/KadabraBetweenness.hpp>":
 		vector[double] scores() except +
 		count getNumberOfIterations() except +
 		double getOmega() except +
+		double getSamplesPerSecond() except +
 
 cdef class KadabraBetweenness(Algorithm):
 	"""
@@ -404,6 +433,19 @@ cdef class KadabraBetweenness(Algorithm):
 		"""
 		return(<_KadabraBetweenness*>(self._this)).getOmega()
 
+	def getSamplesPerSecond(self):
+		"""
+		getSamplesPerSecond()
+
+		Returns the number of samples drawn per second by the adaptive sampling phase.
+
+		Returns
+		-------
+		float
+			Sampling throughput of the last run.
+		"""
+		return (<_KadabraBetweenness*>(self._this)).getSamplesPerSecond()
+
 cdef extern from "<networkit/centrality/DynBetweenness.hpp>":
 
 	cdef cppclass _DynBetweenness "NetworKit::DynBetweenness"(_Algorithm, _DynAlgorithm):
@@ -867,6 +909,7 @@ cdef extern from "<networkit/centrality/TopCloseness.hpp>":
 		vector[node] topkNodesList(bool_t) except +
 		vector[edgeweight] topkScoresList(bool_t) except +
 		void restrictTopKComputationToNodes(const vector[node] &nodeList) except +
+		void setBatchedBFS(bool_t) except +
 
 
 cdef class TopCloseness(Algorithm):
@@ -962,6 +1005,21 @@ cdef class TopCloseness(Algorithm):
 		"""
 		return (<_TopCloseness*>(self._this)).restrictTopKComputationToNodes(nodeList)
 
+	def setBatchedBFS(self, batched):
+		"""
+		setBatchedBFS(batched)
+
+		If set to True, the candidates are analyzed in batches of 64 nodes that share one
+		bit-parallel multi-source BFS. A BFS is cut as soon as the bound on the
+		farness of its source exceeds the current k-th farness.
+
+		Parameters
+		----------
+		batched : bool
+			Whether to use the batched BFS. Default: False
+		"""
+		(<_TopCloseness*>(self._this)).setBatchedBFS(batched)
+
 cdef extern from "<networkit/centrality/TopHarmonicCloseness.hpp>":
 
 	cdef cppclass _TopHarmonicCloseness "NetworKit::TopHarmonicCloseness"(_Algorithm):
@@ -969,6 +1027,7 @@ cdef extern from "<networkit/centrality/TopHarmonicCloseness.hpp>":
 		vector[node] topkNodesList(bool_t) except +
 		vector[edgeweight] topkScoresList(bool_t) except +
 		void restrictTopKComputationToNodes(const vector[node] &nodeList) except +
+		void setBatchedBFS(bool_t) except +
 
 
 cdef class TopHarmonicCloseness(Algorithm):
@@ -1066,6 +1125,22 @@ cdef class TopHarmonicCloseness(Algorithm):
 		"""
 		return (<_TopHarmonicCloseness*>(self._this)).restrictTopKComputationToNodes(nodeList)
 
+	def setBatchedBFS(self, batched):
+		"""
+		setBatchedBFS(batched)
+
+		If set to True, the candidates are analyzed in batches of 64 nodes that share one
+		bit-parallel multi-source BFS. A BFS is cut as soon as the bound on the
+		harmonic closeness of its source drops below the current k-th value.
+		Only applies to the NBcut variation on unweighted graphs.
+
+		Parameters
+		----------
+		batched : bool
+			Whether to use the batched BFS. Default: False
+		"""
+		(<_TopHarmonicCloseness*>(self._this)).setBatchedBFS(batched)
+
 
 
 cdef extern from "<networkit/centrality/DynTopHarmonicCloseness.hpp>":
@@ -2531,7 +2606,7 @@ cdef class ApproxElectricalCloseness(Centrality):
 
 		Compute and return the nearly-exact values of the diagonal of the laplacian's pseudoinverse.
 		The values are computed by solving :math:`Lx = e_u - 1 / n` for every vertex `u` of the graph with a
-		LAMG solver.
+		LAMG solver, which solves the systems of several vertices at once.
 
 		Parameters
 		----------
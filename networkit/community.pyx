@@ -699,6 +699,81 @@ cdef class PLM(CommunityDetector):
 		"""
 		return Partition().setThis(PLM_prolong(Gcoarse._this, zetaCoarse._this, Gfine._this, nodeToMetaNode))
 
+cdef extern from "<networkit/community/KWayPartitioner.hpp>":
+
+	cdef cppclass _KWayPartitioner "NetworKit::KWayPartitioner"(_CommunityDetectionAlgorithm):
+		_KWayPartitioner(_Graph _G, count k, double epsilon, count maxRefinementIterations) except +
+		edgeweight getEdgeCut() except +
+		count getCommunicationVolume() except +
+		double getImbalance() except +
+
+
+cdef class KWayPartitioner(CommunityDetector):
+	"""
+	KWayPartitioner(G, k, epsilon=0.03, maxRefinementIterations=16)
+
+	Multilevel partitioner that divides the nodes of an undirected graph into k blocks of
+	(almost) equal size while keeping the weight of the cut edges small. The graph is coarsened
+	by contracting clusters found by size-constrained label propagation, the coarsest graph is
+	partitioned along BFS orders, and the partition is refined on every level by parallel
+	size-constrained label propagation.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The undirected input graph.
+	k : int
+		The number of blocks.
+	epsilon : float, optional
+		The allowed imbalance: blocks should have at most (1 + epsilon) * ceil(n / k) nodes. The
+		constraint is best-effort, use getImbalance() to check the result. Default: 0.03
+	maxRefinementIterations : int, optional
+		Maximum number of label propagation rounds per level. Default: 16
+	"""
+
+	def __cinit__(self, Graph G not None, count k, double epsilon=0.03, count maxRefinementIterations=16):
+		self._G = G
+		self._this = new _KWayPartitioner(G._this, k, epsilon, maxRefinementIterations)
+
+	def getEdgeCut(self):
+		"""
+		getEdgeCut()
+
+		Returns the total weight of the edges between different blocks.
+
+		Returns
+		-------
+		float
+			The edge cut.
+		"""
+		return (<_KWayPartitioner*>(self._this)).getEdgeCut()
+
+	def getCommunicationVolume(self):
+		"""
+		getCommunicationVolume()
+
+		Returns the sum over all nodes of the number of other blocks that contain a neighbor of the node.
+
+		Returns
+		-------
+		int
+			The communication volume.
+		"""
+		return (<_KWayPartitioner*>(self._this)).getCommunicationVolume()
+
+	def getImbalance(self):
+		"""
+		getImbalance()
+
+		Returns the size of the largest block divided by ceil(n / k), minus 1.
+
+		Returns
+		-------
+		float
+			The imbalance.
+		"""
+		return (<_KWayPartitioner*>(self._this)).getImbalance()
+
 cdef extern from "<networkit/community/ParallelLeiden.hpp>":
 
 	cdef cppclass _ParallelLeiden "NetworKit::ParallelLeiden"(_CommunityDetectionAlgorithm):
@@ -79,7 +79,9 @@ double Vector::operator*(const Vector &other) const {
 }
 
 Vector Vector::operator*(double scalar) const {
-    return Vector(*this) *= scalar;
+    Vector result(*this);
+    result *= scalar;
+    return result;
 }
 
 Vector &Vector::operator*=(double scalar) {
@@ -92,7 +94,9 @@ Vector &Vector::operator*=(double scalar) {
 }
 
 Vector Vector::operator/(double divisor) const {
-    return Vector(*this) /= divisor;
+    Vector result(*this);
+    result /= divisor;
+    return result;
 }
 
 Vector &Vector::operator/=(double divisor) {
@@ -100,11 +104,15 @@ Vector &Vector::operator/=(double divisor) {
 }
 
 Vector Vector::operator+(const Vector &other) const {
-    return Vector(*this) += other;
+    Vector result(*this);
+    result += other;
+    return result;
 }
 
 Vector Vector::operator+(double value) const {
-    return Vector(*this) += value;
+    Vector result(*this);
+    result += value;
+    return result;
 }
 
 Vector &Vector::operator+=(const Vector &other) {
@@ -129,11 +137,15 @@ Vector &Vector::operator+=(const double value) {
 }
 
 Vector Vector::operator-(const Vector &other) const {
-    return Vector(*this) -= other;
+    Vector result(*this);
+    result -= other;
+    return result;
 }
 
 Vector Vector::operator-(const double value) const {
-    return Vector(*this) -= value;
+    Vector result(*this);
+    result -= value;
+    return result;
 }
 
 Vector &Vector::operator-=(const Vector &other) {
@@ -157,4 +169,56 @@ Vector &Vector::operator-=(const double value) {
     return *this;
 }
 
+Vector &Vector::subtractFrom(const Vector &other) {
+    assert(isTransposed() == other.isTransposed()); // vectors must be transposed correctly
+    assert(getDimension() == other.getDimension()); // dimensions of vectors must match
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); i++) {
+        values[i] = other[i] - values[i];
+    }
+
+    return *this;
+}
+
+Vector &Vector::addScaled(double alpha, const Vector &other) {
+    assert(isTransposed() == other.isTransposed()); // vectors must be transposed correctly
+    assert(getDimension() == other.getDimension()); // dimensions of vectors must match
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); i++) {
+        values[i] += alpha * other[i];
+    }
+
+    return *this;
+}
+
+Vector &Vector::scaleAndAdd(double alpha, const Vector &other) {
+    assert(isTransposed() == other.isTransposed()); // vectors must be transposed correctly
+    assert(getDimension() == other.getDimension()); // dimensions of vectors must match
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); i++) {
+        values[i] = alpha * values[i] + other[i];
+    }
+
+    return *this;
+}
+
+double Vector::addScaledAndSquaredLength(double alpha, const Vector &other) {
+    assert(isTransposed() == other.isTransposed()); // vectors must be transposed correctly
+    assert(getDimension() == other.getDimension()); // dimensions of vectors must match
+
+    double sqrLength = 0.;
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(+ : sqrLength)
+#endif
+    for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); i++) {
+        values[i] += alpha * other[i];
+        sqrLength += values[i] * values[i];
+    }
+
+    return sqrLength;
+}
+
 } /* namespace NetworKit */
@@ -251,6 +251,42 @@ TEST(VectorGTest, testVectorSubtraction) {
     EXPECT_EQ(v1[3], 3.0);
 }
 
+TEST(VectorGTest, testVectorTemporaryOperands) {
+    const Vector v1 = {2.0, 4.0, 6.0, 8.0};
+    const Vector v2 = {1.0, 2.0, 3.0, 4.0};
+
+    EXPECT_EQ(v1 - Vector(v2), Vector({1.0, 2.0, 3.0, 4.0}));
+    EXPECT_EQ(Vector(v1) - v2, Vector({1.0, 2.0, 3.0, 4.0}));
+    EXPECT_EQ(Vector(v1) - Vector(v2), Vector({1.0, 2.0, 3.0, 4.0}));
+    EXPECT_EQ(v1 + Vector(v2), Vector({3.0, 6.0, 9.0, 12.0}));
+    EXPECT_EQ(Vector(v1) + v2, Vector({3.0, 6.0, 9.0, 12.0}));
+    EXPECT_EQ(Vector(v1) + Vector(v2), Vector({3.0, 6.0, 9.0, 12.0}));
+    EXPECT_EQ(2.0 * Vector(v2), v1);
+    EXPECT_EQ(Vector(v2) * 2.0, v1);
+    EXPECT_EQ(Vector(v1) / 2.0, v2);
+
+    Vector v3 = v1;
+    v3.subtractFrom(v2);
+    EXPECT_EQ(v3, Vector({-1.0, -2.0, -3.0, -4.0}));
+}
+
+TEST(VectorGTest, testFusedVectorKernels) {
+    const Vector x = {1.0, 2.0, 3.0, 4.0};
+
+    Vector y = {1.0, 1.0, 1.0, 1.0};
+    y.addScaled(2.0, x);
+    EXPECT_EQ(y, Vector({3.0, 5.0, 7.0, 9.0}));
+
+    y.scaleAndAdd(0.5, x);
+    EXPECT_EQ(y, Vector({2.5, 4.5, 6.5, 8.5}));
+
+    y = Vector{1.0, 1.0, 1.0, 1.0};
+    const double sqrLength = y.addScaledAndSquaredLength(-1.0, x);
+    EXPECT_EQ(y, Vector({0.0, -1.0, -2.0, -3.0}));
+    EXPECT_DOUBLE_EQ(sqrLength, 14.0);
+    EXPECT_DOUBLE_EQ(sqrLength, y.length() * y.length());
+}
+
 TEST(VectorGTest, testVectorIterators) {
     Vector v = {1.0, 2.0, 3.0, 4.0, 5.0};
 
@@ -26,6 +26,7 @@
 #include <networkit/auxiliary/BloomFilter.hpp>
 #include <networkit/auxiliary/BucketPQ.hpp>
 #include <networkit/auxiliary/Enforce.hpp>
+#include <networkit/auxiliary/HashAccumulator.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/MissingMath.hpp>
 #include <networkit/auxiliary/NumberParsing.hpp>
@@ -582,4 +583,35 @@ TEST_F(AuxGTest, testApplyPermutation) {
     testPermutation(std::vector<node>{n});
     testPermutation(std::vector<int>{n});
 }
+
+TEST_F(AuxGTest, testHashAccumulator) {
+    HashAccumulator<double> accumulator;
+    // the table is reused after growing and shrinking again
+    for (count extraKeys : {0, 95, 0}) {
+        // keys that collide modulo small powers of two
+        std::vector<index> keys{7, 7 + 1024, 3, 7, none - 1};
+        for (index key = 1; key <= extraKeys; ++key)
+            keys.push_back(key * 64);
+        const count numKeys = std::set<index>(keys.begin(), keys.end()).size();
+
+        accumulator.reset(numKeys);
+        EXPECT_EQ(accumulator.size(), 0);
+        EXPECT_EQ(accumulator.get(7), 0.0);
+
+        for (index key : keys)
+            accumulator.add(key, 1.5);
+
+        std::vector<index> order;
+        accumulator.forEntries([&](index key, double sum) {
+            order.push_back(key);
+            EXPECT_EQ(sum, 1.5 * std::count(keys.begin(), keys.end(), key));
+        });
+        EXPECT_EQ(order[0], 7);
+        EXPECT_EQ(order[1], 7 + 1024);
+        EXPECT_EQ(order.size(), numKeys);
+        EXPECT_EQ(accumulator.size(), numKeys);
+        EXPECT_EQ(accumulator.get(7), 3.0);
+        EXPECT_EQ(accumulator.get(8), 0.0);
+    }
+}
 } // namespace NetworKit
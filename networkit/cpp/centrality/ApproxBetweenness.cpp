@@ -9,7 +9,7 @@
 #include <networkit/auxiliary/Random.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/centrality/ApproxBetweenness.hpp>
-#include <networkit/distance/BFS.hpp>
+#include <networkit/centrality/ShortestPathSampler.hpp>
 #include <networkit/distance/Diameter.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/SSSP.hpp>
@@ -30,6 +30,7 @@ void ApproxBetweenness::run() {
     Aux::SignalHandler handler;
     scoreData.clear();
     scoreData.resize(G.upperNodeIdBound());
+    throughput = 0;
 
     edgeweight vd = 0;
 
@@ -47,14 +48,20 @@ void ApproxBetweenness::run() {
 
     INFO("taking ", r, " path samples");
     handler.assureRunning();
-#pragma omp parallel
-    {
-        auto ssspPtr = G.isWeighted() ? std::unique_ptr<SSSP>(new Dijkstra(G, 0, true, false))
-                                      : std::unique_ptr<SSSP>(new BFS(G, 0, true, false));
-
-#pragma omp for
-        for (omp_index i = 1; i <= static_cast<omp_index>(r); i++) {
-            DEBUG("sample ", i);
+    PathSamplingEngine engine(G);
+    if (!G.isWeighted()) {
+        const std::vector<count> counts = engine.samplePaths(r, Aux::Random::integer());
+        G.parallelForNodes([&](node u) {
+            scoreData[u] = static_cast<double>(counts[u]) / static_cast<double>(r);
+        });
+    } else {
+        // Bidirectional BFS cannot handle edge weights, sample paths from Dijkstra trees instead.
+        std::vector<std::unique_ptr<SSSP>> sssps(engine.numberOfThreads());
+        engine.run(r, scoreData, [&](index, std::vector<double> &scores) {
+            auto &ssspPtr = sssps[omp_get_thread_num()];
+            if (!ssspPtr)
+                ssspPtr = std::make_unique<Dijkstra>(G, 0, true, false);
+
             // sample random node pair
             node u, v;
             u = GraphTools::randomNode(G);
@@ -68,10 +75,8 @@ void ApproxBetweenness::run() {
 
             DEBUG("running shortest path algorithm for node ", u);
             if (!handler.isRunning())
-                continue;
+                return;
             sssp.run();
-            if (!handler.isRunning())
-                continue;
             if (sssp.numberOfPaths(v) > 0) { // at least one path between {u, v} exists
                 DEBUG("updating estimate for path ", u, " <-> ", v);
                 // random path sampling and estimation update
@@ -88,18 +93,23 @@ void ApproxBetweenness::run() {
                     node z = Aux::Random::weightedChoice(choices);
                     assert(z <= G.upperNodeIdBound());
                     if (z != u)
-#pragma omp atomic
-                        scoreData[z] += 1. / static_cast<double>(r);
+                        scores[z] += 1. / static_cast<double>(r);
                     t = z;
                 }
             }
-        }
+        });
     }
+    throughput = engine.samplesPerSecond();
     handler.assureRunning();
 
     hasRun = true;
 }
 
+double ApproxBetweenness::samplesPerSecond() const {
+    assureFinished();
+    return throughput;
+}
+
 count ApproxBetweenness::numberOfSamples() const {
     assureFinished();
     INFO("Estimated number of samples", r);
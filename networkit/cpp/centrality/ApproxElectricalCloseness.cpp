@@ -545,53 +545,25 @@ std::vector<double> ApproxElectricalCloseness::computeExactDiagonal(double tol)
     lamg.setupConnected(CSRMatrix::laplacianMatrix(G));
 
     const count n = G.numberOfNodes();
-    const count maxThreads = static_cast<count>(omp_get_max_threads());
-
-    // Solution vectors: one per thread
-    std::vector<Vector> solutions(maxThreads, Vector(n));
-
-    // Right hand side vectors: one per thread
-    std::vector<Vector> rhss(maxThreads, Vector(n));
-
     std::vector<double> diag(n);
+    std::vector<Vector> rhss, solutions;
 
-    const count iters = (n % maxThreads == 0) ? n / maxThreads : n / maxThreads + 1;
-    for (count i = 0; i < iters; ++i) {
-        // Index of the next vertex to process
-        const index base = i * maxThreads;
-
-#pragma omp parallel
-        {
-            // Each thread solves a linear system from `base` to `base + #threads - 1`
-            const index thread = omp_get_thread_num();
-            const node v = base + thread;
-            if (v < n) {
-                // Reset solution and rhs vector of the current thread
-                solutions[thread].fill(0.0);
-
-                // Set up system to compute the diagonal entry L^+[v, v]
-                rhss[thread].fill(-1. / static_cast<double>(n));
-                rhss[thread][v] += 1.;
-            }
-        }
+    // Every thread gets a block of vertices whose systems Lamg solves simultaneously.
+    const count chunkSize =
+        static_cast<count>(omp_get_max_threads()) * Lamg<CSRMatrix>::DEFAULT_BLOCK_SIZE;
+    for (index base = 0; base < n; base += chunkSize) {
+        const count k = std::min<count>(chunkSize, n - base);
 
-        if (base + maxThreads >= n) {
-            // Last iteration: some threads cannot be used.
-            // Resize rhss and solutions to the number of vertices left to be processed.
-            rhss.resize(n - base);
-            solutions.resize(rhss.size());
-        }
+        // Set up the systems to compute the diagonal entries L^+[v, v]
+        rhss.assign(k, Vector(n, -1. / static_cast<double>(n)));
+        solutions.assign(k, Vector(n, 0.));
+        for (index c = 0; c < k; ++c)
+            rhss[c][base + c] += 1.;
 
         lamg.parallelSolve(rhss, solutions);
 
-        // Store the results
-        for (index idx = 0; idx < solutions.size(); ++idx) {
-            const node v = base + idx;
-            if (v < n)
-                diag[v] = solutions[idx][v];
-            else
-                break;
-        }
+        for (index c = 0; c < k; ++c)
+            diag[base + c] = solutions[c][base + c];
     }
 
     return diag;
@@ -5,6 +5,8 @@
  *      Author: cls, ebergamini
  */
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <omp.h>
 
@@ -20,7 +22,6 @@ Betweenness::Betweenness(const Graph &G, bool normalized, bool computeEdgeCentra
     : Centrality(G, normalized, computeEdgeCentrality) {}
 
 void Betweenness::run() {
-    Aux::SignalHandler handler;
     const count z = G.upperNodeIdBound();
     scoreData.clear();
     scoreData.resize(z);
@@ -30,58 +31,12 @@ void Betweenness::run() {
         edgeScoreData.resize(z2);
     }
 
-    std::vector<std::vector<double>> dependencies(omp_get_max_threads(), std::vector<double>(z));
-    std::vector<std::unique_ptr<SSSP>> sssps;
-    sssps.resize(omp_get_max_threads());
-#pragma omp parallel
-    {
-        omp_index i = omp_get_thread_num();
-        if (G.isWeighted())
-            sssps[i] = std::unique_ptr<SSSP>(new Dijkstra(G, 0, true, true));
-        else
-            sssps[i] = std::unique_ptr<SSSP>(new BFS(G, 0, true, true));
-    }
-
-    auto computeDependencies = [&](node s) -> void {
-        std::vector<double> &dependency = dependencies[omp_get_thread_num()];
-        std::fill(dependency.begin(), dependency.end(), 0);
-
-        // run SSSP algorithm and keep track of everything
-        auto &sssp = *sssps[omp_get_thread_num()];
-        sssp.setSource(s);
-        if (!handler.isRunning())
-            return;
-        sssp.run();
-        if (!handler.isRunning())
-            return;
-        // compute dependencies for nodes in order of decreasing distance from s
-        std::vector<node> stack = sssp.getNodesSortedByDistance();
-        while (!stack.empty()) {
-            node t = stack.back();
-            stack.pop_back();
-            for (node p : sssp.getPredecessors(t)) {
-                // workaround for integer overflow in large graphs
-                bigfloat tmp = sssp.numberOfPaths(p) / sssp.numberOfPaths(t);
-                double weight;
-                tmp.ToDouble(weight);
-                double c = weight * (1 + dependency[t]);
-                dependency[p] += c;
-
-                if (computeEdgeCentrality) {
-                    const edgeid edgeId = G.edgeId(p, t);
-#pragma omp atomic
-                    edgeScoreData[edgeId] += c;
-                }
-            }
-
-            if (t != s)
-#pragma omp atomic
-                scoreData[t] += dependency[t];
-        }
-    };
-    handler.assureRunning();
-    G.balancedParallelForNodes(computeDependencies);
-    handler.assureRunning();
+    if (parallelTraversal && !G.isWeighted())
+        runParallelTraversal();
+    else if (singlePrecisionDependencies)
+        runSourceParallel<float>();
+    else
+        runSourceParallel<double>();
 
     if (normalized) {
         // divide by the number of possible pairs
@@ -101,6 +56,168 @@ void Betweenness::run() {
     hasRun = true;
 }
 
+template <typename Dependency>
+void Betweenness::runSourceParallel() {
+    Aux::SignalHandler handler;
+    const count z = G.upperNodeIdBound();
+    count workers = static_cast<count>(omp_get_max_threads());
+    if (maxConcurrentSources > 0)
+        workers = std::min(workers, maxConcurrentSources);
+
+    // Workers only keep private dependencies, node scores are accumulated into the shared
+    // scoreData so that the memory footprint does not grow with the number of workers.
+    handler.assureRunning();
+#pragma omp parallel num_threads(workers)
+    {
+        std::vector<Dependency> dependency(z);
+
+        std::unique_ptr<SSSP> sssp;
+        if (G.isWeighted())
+            sssp = std::unique_ptr<SSSP>(new Dijkstra(G, 0, true, true));
+        else
+            sssp = std::unique_ptr<SSSP>(new BFS(G, 0, true, true));
+
+#pragma omp for schedule(dynamic)
+        for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+            const node s = static_cast<node>(i);
+            if (!G.hasNode(s) || !handler.isRunning())
+                continue;
+
+            // run SSSP algorithm and keep track of everything
+            sssp->setSource(s);
+            sssp->run();
+
+            // compute dependencies for nodes in order of decreasing distance from s
+            const std::vector<node> &sorted = sssp->getNodesSortedByDistance();
+            for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+                const node t = *it;
+                for (node p : sssp->getPredecessors(t)) {
+                    // workaround for integer overflow in large graphs
+                    bigfloat tmp = sssp->numberOfPaths(p) / sssp->numberOfPaths(t);
+                    double weight;
+                    tmp.ToDouble(weight);
+                    double c = weight * (1 + dependency[t]);
+                    dependency[p] += static_cast<Dependency>(c);
+
+                    if (computeEdgeCentrality) {
+                        const edgeid edgeId = G.edgeId(p, t);
+#pragma omp atomic
+                        edgeScoreData[edgeId] += c;
+                    }
+                }
+
+                if (t != s) {
+#pragma omp atomic
+                    scoreData[t] += dependency[t];
+                }
+            }
+
+            // only the reached nodes carry a non-zero dependency
+            for (node t : sorted)
+                dependency[t] = 0;
+        }
+    }
+    handler.assureRunning();
+}
+
+void Betweenness::runParallelTraversal() {
+    Aux::SignalHandler handler;
+    const count z = G.upperNodeIdBound();
+
+    std::vector<std::atomic<index>> level(z);
+    std::vector<double> numPaths(z), dependency(z);
+#pragma omp parallel for
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v)
+        level[v].store(none, std::memory_order_relaxed);
+
+    std::vector<std::vector<node>> levels;
+    std::vector<std::vector<node>> buffers(omp_get_max_threads());
+
+    handler.assureRunning();
+    for (node s = 0; s < z; ++s) {
+        if (!G.hasNode(s))
+            continue;
+        handler.assureRunning();
+
+        levels.clear();
+        levels.push_back({s});
+        level[s].store(0, std::memory_order_relaxed);
+        numPaths[s] = 1;
+
+        // Level-synchronous BFS; the number of shortest paths to a node is pulled from its
+        // predecessors on the previous level once the level is complete.
+        while (!levels.back().empty()) {
+            const index d = levels.size();
+            const std::vector<node> &frontier = levels.back();
+#pragma omp parallel
+            {
+                auto &buffer = buffers[omp_get_thread_num()];
+                buffer.clear();
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    G.forNeighborsOf(frontier[i], [&](node v) {
+                        index expected = none;
+                        if (level[v].load(std::memory_order_relaxed) == none
+                            && level[v].compare_exchange_strong(expected, d,
+                                                                std::memory_order_relaxed))
+                            buffer.push_back(v);
+                    });
+                }
+            }
+
+            std::vector<node> next;
+            for (const auto &buffer : buffers)
+                next.insert(next.end(), buffer.begin(), buffer.end());
+
+#pragma omp parallel for schedule(guided)
+            for (omp_index i = 0; i < static_cast<omp_index>(next.size()); ++i) {
+                const node v = next[i];
+                double paths = 0;
+                G.forInNeighborsOf(v, [&](node u) {
+                    if (level[u].load(std::memory_order_relaxed) == d - 1)
+                        paths += numPaths[u];
+                });
+                numPaths[v] = paths;
+            }
+
+            levels.push_back(std::move(next));
+        }
+        levels.pop_back();
+
+        // Accumulate the dependencies level by level, every node pulls them from its successors.
+        for (index d = levels.size(); d-- > 0;) {
+            const std::vector<node> &current = levels[d];
+#pragma omp parallel for schedule(guided)
+            for (omp_index i = 0; i < static_cast<omp_index>(current.size()); ++i) {
+                const node v = current[i];
+                double dep = 0;
+                G.forEdgesOf(v, [&](node, node w, edgeweight, edgeid eid) {
+                    if (level[w].load(std::memory_order_relaxed) != d + 1)
+                        return;
+                    const double c = numPaths[v] / numPaths[w] * (1 + dependency[w]);
+                    dep += c;
+                    if (computeEdgeCentrality)
+                        edgeScoreData[eid] += c;
+                });
+                dependency[v] = dep;
+                if (v != s)
+                    scoreData[v] += dep;
+            }
+        }
+
+        // reset the state of the reached nodes only
+        for (const auto &current : levels) {
+#pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(current.size()); ++i) {
+                const node v = current[i];
+                level[v].store(none, std::memory_order_relaxed);
+                numPaths[v] = 0;
+                dependency[v] = 0;
+            }
+        }
+    }
+}
+
 double Betweenness::maximum() {
     if (normalized) {
         return 1;
@@ -9,6 +9,7 @@
 
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/centrality/EigenvectorCentrality.hpp>
+#include <networkit/centrality/PowerIteration.hpp>
 
 namespace NetworKit {
 
@@ -16,11 +17,13 @@ EigenvectorCentrality::EigenvectorCentrality(const Graph &G, double tol)
     : Centrality(G, true), tol(tol) {}
 
 void EigenvectorCentrality::run() {
+    const PowerIteration spmv(G);
     std::vector<double> values(G.upperNodeIdBound(), 1.0);
     scoreData = values;
 
     double length = 0.0;
     double oldLength = 0.0;
+    double scale = 1.0;
 
     auto converged([tol = tol](double val, double other) -> bool {
         // compute residual
@@ -30,23 +33,21 @@ void EigenvectorCentrality::run() {
     do {
         oldLength = length;
 
-        // iterate matrix-vector product
-        G.parallelForNodes([&](node u) {
-            values[u] = 0.0;
-            G.forInEdgesOf(u,
-                           [&](node u, node v, edgeweight ew) { values[u] += ew * scoreData[v]; });
-        });
-
-        // normalize values
-        length = G.parallelSumForNodes([&values](node u) { return (values[u] * values[u]); });
-        length = std::sqrt(length);
+        // iterate matrix-vector product; the normalization of the previous iterate is applied
+        // on the fly, so each iteration needs a single pass over the graph
+        length = spmv.multiply(scoreData, values, [scale](node, double sum) {
+                         return sum * scale;
+                     }).norm();
 
         assert(!Aux::NumericTools::equal(length, 1e-16));
-        G.parallelForNodes([&values, length](node u) { values[u] /= length; });
+        scale = 1.0 / length;
 
         std::swap(scoreData, values);
     } while (!converged(length, oldLength));
 
+    // normalize values
+    G.parallelForNodes([&](node u) { scoreData[u] *= scale; });
+
     // check sign and correct if necessary
     if (scoreData[0] < 0) {
         G.parallelForNodes([&](node u) { scoreData[u] = std::fabs(scoreData[u]); });
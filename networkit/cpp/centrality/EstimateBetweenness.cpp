@@ -8,6 +8,7 @@
 #include <networkit/auxiliary/Parallelism.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/centrality/EstimateBetweenness.hpp>
+#include <networkit/centrality/ShortestPathSampler.hpp>
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/SSSP.hpp>
@@ -34,32 +35,36 @@ void EstimateBetweenness::run() {
         sampledNodes.push_back(GraphTools::randomNode(G));
     }
 
-    // thread-local scores for efficient parallelism
-    count maxThreads = omp_get_max_threads();
-    if (!parallel_flag)
-        maxThreads = 1;
-    std::vector<std::vector<double>> scorePerThread(maxThreads,
-                                                    std::vector<double>(G.upperNodeIdBound()));
+    // thread-local scores and search state for efficient parallelism
+    PathSamplingEngine engine(G, parallel_flag);
+    std::vector<std::unique_ptr<SSSP>> sssps(engine.numberOfThreads());
+    std::vector<std::vector<double>> dependencies(engine.numberOfThreads());
 
-    auto computeDependencies = [&](node s) {
+    auto computeDependencies = [&](index i, std::vector<double> &scores) {
+        const node s = sampledNodes[i];
+        const index thread = omp_get_thread_num();
         // run single-source shortest path algorithm
-        std::unique_ptr<SSSP> sssp;
-        if (G.isWeighted()) {
-            sssp = std::make_unique<Dijkstra>(G, s, true, true);
-        } else {
-            sssp = std::make_unique<BFS>(G, s, true, true);
+        auto &sssp = sssps[thread];
+        if (!sssp) {
+            if (G.isWeighted()) {
+                sssp = std::make_unique<Dijkstra>(G, s, true, true);
+            } else {
+                sssp = std::make_unique<BFS>(G, s, true, true);
+            }
         }
+        sssp->setSource(s);
         if (!handler.isRunning())
             return;
         sssp->run();
         if (!handler.isRunning())
             return;
 
-        // create stack of nodes in non-decreasing order of distance
-        auto stack = sssp->getNodesSortedByDistance();
+        // nodes in non-decreasing order of distance
+        const auto &stack = sssp->getNodesSortedByDistance();
 
         // compute dependencies and add the contributions to the centrality score
-        std::vector<double> dependency(G.upperNodeIdBound(), 0.0);
+        auto &dependency = dependencies[thread];
+        dependency.resize(G.upperNodeIdBound());
         for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
             node t = *it;
             if (t == s) {
@@ -76,25 +81,17 @@ void EstimateBetweenness::run() {
                 dependency[p] +=
                     (double(sssp->distance(p)) / sssp->distance(t)) * weight * (1 + dependency[t]);
             }
-            scorePerThread[omp_get_thread_num()][t] += dependency[t];
+            scores[t] += dependency[t];
         }
-    };
 
-#pragma omp parallel for if (parallel_flag)
-    for (omp_index i = 0; i < static_cast<omp_index>(sampledNodes.size()); ++i) {
-        computeDependencies(sampledNodes[i]);
-    }
+        // only the reached nodes carry a non-zero dependency
+        for (node t : stack)
+            dependency[t] = 0;
+    };
 
-    if (parallel_flag) {
-        scoreData = std::vector<double>(G.upperNodeIdBound(), 0.0);
-
-        // add up all thread-local values
-        for (const auto &local : scorePerThread) {
-            G.parallelForNodes([&](node v) { scoreData[v] += local[v]; });
-        }
-    } else {
-        scoreData.swap(scorePerThread[0]);
-    }
+    scoreData.assign(G.upperNodeIdBound(), 0.0);
+    engine.run(sampledNodes.size(), scoreData, computeDependencies);
+    throughput = engine.samplesPerSecond();
 
     const count n = G.numberOfNodes();
     const count pairs = (n - 2) * (n - 1);
@@ -113,4 +110,9 @@ void EstimateBetweenness::run() {
     hasRun = true;
 }
 
+double EstimateBetweenness::samplesPerSecond() const {
+    assureFinished();
+    return throughput;
+}
+
 } /* namespace NetworKit */
@@ -5,12 +5,11 @@
  *      Author: elisabetta bergamini
  */
 
-#include <networkit/auxiliary/BucketPQ.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/centrality/GroupCloseness.hpp>
 #include <networkit/centrality/TopCloseness.hpp>
 
-#include <atomic>
+#include <algorithm>
 #include <memory>
 #include <omp.h>
 #include <queue>
@@ -18,38 +17,62 @@
 namespace NetworKit {
 
 GroupCloseness::GroupCloseness(const Graph &G, count k, count H) : G(&G), k(k), H(H) {
-    d1Global.resize(omp_get_max_threads(), std::vector<count>(G.upperNodeIdBound()));
+    const count threads = omp_get_max_threads();
+    d1Global.resize(threads, std::vector<count>(G.upperNodeIdBound()));
+    timestampGlobal.resize(threads, std::vector<count>(G.upperNodeIdBound()));
+    curTimestamp.resize(threads, 0);
+    queueGlobal.resize(threads);
 }
 
-edgeweight GroupCloseness::computeImprovement(node u, count h) {
+LazyGreedy::Evaluation GroupCloseness::computeImprovement(node u, count h, double threshold) {
     // computes the marginal gain due to adding u to S
-    auto &d1 = d1Global[omp_get_thread_num()];
-    std::copy(d.begin(), d.end(), d1.begin());
+    const index thread = omp_get_thread_num();
+    auto &d1 = d1Global[thread];
+    auto &timestamp = timestampGlobal[thread];
+    auto &queue = queueGlobal[thread];
+    const count ts = ++curTimestamp[thread];
 
     d1[u] = 0;
+    timestamp[u] = ts;
     count improvement = d[u]; // old distance of u
-    std::queue<node> Q;
-    Q.push(u);
+    queue.clear();
+    queue.push_back(u);
+
+    index begin = 0;
+    for (count level = 0; begin < queue.size() && (h == 0 || level <= h); ++level) {
+        const index end = queue.size();
+        count maxImprovement = 0;
+        for (; begin < end; ++begin) {
+            G->forNeighborsOf(queue[begin], [&](node w) {
+                // Nodes reached before have d1[w] <= level + 1, so d[w] is the current distance
+                if (timestamp[w] != ts && d[w] > level + 1) {
+                    d1[w] = level + 1;
+                    timestamp[w] = ts;
+                    improvement += d[w] - d1[w];
+                    maxImprovement = std::max(maxImprovement, d[w] - d1[w]);
+                    queue.push_back(w);
+                }
+            });
+        }
 
-    index level = 0;
-    while (!Q.empty() && (h == 0 || level <= h)) {
-        node v = Q.front();
-        Q.pop();
-        level = d1[v];
-        G->forNeighborsOf(v, [&](node w) {
-            if (d1[w] > d1[v] + 1) {
-                d1[w] = d1[v] + 1;
-                improvement += d[w] - d1[w];
-                Q.push(w);
-            }
-        });
+        // The improvement cannot increase along a shortest path from u, so the nodes that have
+        // not been reached yet improve by at most maxImprovement. They end up at distance at
+        // least level + 2 from the group, which also bounds their improvement.
+        if (static_cast<double>(improvement) > threshold || begin == queue.size())
+            continue;
+        count bound = improvement;
+        for (count dist = level + 3; dist < distCount.size(); ++dist)
+            bound += distCount[dist] * std::min(maxImprovement, dist - level - 2);
+        if (static_cast<double>(bound) <= threshold)
+            return {static_cast<double>(bound), false};
     }
-    return improvement;
+    return {static_cast<double>(improvement), true};
 }
 
 void GroupCloseness::updateDistances(node u) {
-    count improvement = d[u]; // old distance of u
-    d[u] = 0;                 // now u is in the group
+    --distCount[d[u]];
+    ++distCount[0];
+    d[u] = 0; // now u is in the group
     std::queue<node> Q;
     Q.push(u);
 
@@ -58,8 +81,9 @@ void GroupCloseness::updateDistances(node u) {
         Q.pop();
         G->forNeighborsOf(v, [&](node w) {
             if (d[w] > d[v] + 1) {
-                improvement += d[w] - (d[v] + 1);
+                --distCount[d[w]];
                 d[w] = d[v] + 1;
+                ++distCount[d[w]];
                 Q.push(w);
             }
         });
@@ -70,9 +94,6 @@ void GroupCloseness::run() {
     const count n = G->upperNodeIdBound();
     node top;
 
-    omp_lock_t lock;
-    omp_init_lock(&lock);
-
     if (H == 0) {
         TopCloseness topcc(*G, 1, true, false);
         topcc.run();
@@ -88,65 +109,34 @@ void GroupCloseness::run() {
     Traversal::BFSfrom(*G, top, [&d = d](node u, count distance) { d[u] = distance; });
 
     count sumD = G->parallelSumForNodes([&](node v) { return d[v]; });
+    distCount.assign(*std::max_element(d.begin(), d.end()) + 1, 0);
+    G->forNodes([&](node v) { ++distCount[d[v]]; });
 
     // init S
     S.clear();
     S.resize(k, 0);
     S[0] = top;
 
-    std::vector<int64_t> prevBound(n, 0);
-    count currentImpr = sumD + 1; // TODO change
-
-    std::vector<count> S2(n, sumD);
-    S2[top] = 0;
+    // The marginal gain of a node is at most the sum of the distances to the group
+    std::vector<double> bound(n, static_cast<double>(sumD));
+    LazyGreedy greedy(bound);
+    std::vector<node> candidates;
+    G->forNodes([&](node v) {
+        if (d[v] > 0)
+            candidates.push_back(v);
+    });
+    greedy.setCandidates(candidates.begin(), candidates.end());
 
     // loop to find k group members
     for (index i = 1; i < k; i++) {
         DEBUG("k = ", i);
-        Aux::BucketPQ Q(n, -currentImpr - 1, 0);
-        G->forNodes([&](node v) {
-            if (d[v] > 0)
-                Q.insert(-prevBound[v], v);
-        });
-        currentImpr = 0;
-        node maxNode = none;
-
-        std::atomic<bool> toInterrupt{false};
-#pragma omp parallel
-        {
-            while (!toInterrupt.load(std::memory_order_relaxed)) {
-                omp_set_lock(&lock);
-                if (Q.empty()) {
-                    omp_unset_lock(&lock);
-                    toInterrupt.store(true, std::memory_order_relaxed);
-                    break;
-                }
-
-                const node v = Q.extractMin().second;
-
-                omp_unset_lock(&lock);
-                INFO("Extracted node ", v, " with prio ", prevBound[v]);
-                if (i > 1 && prevBound[v] <= static_cast<int64_t>(currentImpr)) {
-                    INFO("Interrupting! currentImpr = ", currentImpr,
-                         ", previous bound = ", prevBound[v]);
-                    toInterrupt.store(true, std::memory_order_relaxed);
-                    break;
-                }
-                if (i == 1 || prevBound[v] > static_cast<int64_t>(currentImpr)) {
-                    count imp = computeImprovement(v, H);
-                    omp_set_lock(&lock);
-                    if (imp > currentImpr) {
-                        currentImpr = imp;
-                        maxNode = v;
-                    }
-                    omp_unset_lock(&lock);
-                    INFO("New bound for v = ", imp);
-                    prevBound[v] = imp; // TODO use later
-                } else {
-                    prevBound[v] = 0;
-                }
-            }
-        }
+        const node maxNode = greedy.selectNext(
+            [&](node v, double threshold) { return computeImprovement(v, H, threshold); });
+        if (maxNode == none)
+            throw std::runtime_error("Error: the graph has less than k nodes reachable from "
+                                     "the first group member.");
+        DEBUG("Selected node ", maxNode, " after ", greedy.numberOfEvaluations(),
+              " evaluations, improvement = ", greedy.lastGain());
         S[i] = maxNode;
 
         updateDistances(S[i]);
@@ -9,8 +9,7 @@
 
 namespace NetworKit {
 GroupDegree::GroupDegree(const Graph &G, count k, bool countGroupNodes)
-    : G(G), k(k), countGroupNodes(countGroupNodes), n(G.upperNodeIdBound()),
-      queue{n, -static_cast<int64_t>(n) + (countGroupNodes ? 0 : 1), countGroupNodes ? 0 : 1} {
+    : G(G), k(k), countGroupNodes(countGroupNodes), n(G.upperNodeIdBound()), greedy(gain) {
     if (k > G.upperNodeIdBound() || k <= 0) {
         throw std::runtime_error("k must be between 1 and n");
     }
@@ -21,19 +20,13 @@ GroupDegree::GroupDegree(const Graph &G, count k, bool countGroupNodes)
 }
 
 void GroupDegree::init() {
-
-    if (hasRun) {
-        n = G.upperNodeIdBound();
-        queue.clear();
-
-        hasRun = false;
-    }
+    n = G.upperNodeIdBound();
+    hasRun = false;
 
     group.clear();
     group.reserve(k);
     inGroup.assign(n, false);
     reachable.assign(n, false);
-    affected.assign(n, false);
     gain.assign(n, 0);
 }
 
@@ -45,18 +38,15 @@ void GroupDegree::run() {
         if (countGroupNodes) {
             ++curNodeScore;
         }
-        queue.insert(-curNodeScore, u);
-        gain[u] = curNodeScore;
+        gain[u] = static_cast<double>(curNodeScore);
     });
+    greedy.setCandidates(G.nodeRange().begin(), G.nodeRange().end());
 
-    updateGroup();
     while (group.size() < k) {
-        updateQueue();
-        updateGroup();
-    }
-
-    for (node u : G.neighborRange(group.back())) {
-        reachable[u] = true;
+        const node u = greedy.selectNext([&](node v, double) {
+            return LazyGreedy::Evaluation{static_cast<double>(marginalGain(v)), true};
+        });
+        updateGroup(u);
     }
 
     computeScore();
@@ -64,62 +54,21 @@ void GroupDegree::run() {
     hasRun = true;
 }
 
-void GroupDegree::updateGroup() {
-    group.push_back(queue.extractMin().second);
-    inGroup[group.back()] = true;
-    reachable[group.back()] = true;
-}
-
-void GroupDegree::updateQueue() {
-    node lastAdded = group.back();
-    std::fill(affected.begin(), affected.end(), false);
-
-    auto processNode = [&](node v) {
-        if (!inGroup[v]) {
-            affected[v] = true;
+int64_t GroupDegree::marginalGain(node u) const {
+    // u itself is either newly counted as a group node or no longer counted as a neighbor
+    int64_t result = countGroupNodes ? !reachable[u] : -static_cast<int64_t>(reachable[u]);
+    G.forNeighborsOf(u, [&](node v) {
+        if (!reachable[v]) {
+            ++result;
         }
-    };
-
-    for (node u : G.neighborRange(lastAdded)) {
-        if (!inGroup[u] && !reachable[u]) {
-            affected[u] = true;
-            reachable[u] = true;
-            if (G.isDirected()) {
-                G.forInNeighborsOf(u, [&](node v) { processNode(v); });
-            } else {
-                G.forNeighborsOf(u, [&](node v) { processNode(v); });
-            }
-        }
-    }
+    });
+    return result;
+}
 
-#pragma omp parallel for
-    for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
-        if (affected[i]) {
-            int64_t newGain = 0;
-            bool groupNeighbor = false;
-            if (!countGroupNodes && G.isDirected()) {
-                G.forInNeighborsOf(i, [&](node v) {
-                    if (!groupNeighbor && inGroup[v]) {
-                        newGain = -1;
-                        groupNeighbor = true;
-                    }
-                });
-            }
-            G.forNeighborsOf(i, [&](node v) {
-                if (!reachable[v]) {
-                    ++newGain;
-                }
-                if (!countGroupNodes && !G.isDirected()) {
-                    if (!groupNeighbor && inGroup[v]) {
-                        groupNeighbor = true;
-                        --newGain;
-                    }
-                }
-            });
-            gain[i] = newGain;
-#pragma omp critical
-            queue.changeKey(-newGain, i);
-        }
-    }
+void GroupDegree::updateGroup(node u) {
+    group.push_back(u);
+    inGroup[u] = true;
+    reachable[u] = true;
+    G.forNeighborsOf(u, [&](node v) { reachable[v] = true; });
 }
 } // namespace NetworKit
@@ -5,7 +5,6 @@
  *     Author: Eugenio Angriman <angrimae@hu-berlin.de>
  */
 
-#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <limits>
@@ -15,6 +14,7 @@
 
 #include <networkit/auxiliary/VectorComparator.hpp>
 #include <networkit/centrality/GroupHarmonicCloseness.hpp>
+#include <networkit/centrality/LazyGreedy.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/graph/BFS.hpp>
 #include <networkit/graph/Dijkstra.hpp>
@@ -75,7 +75,8 @@ private:
     // Visited nodes, used in graph explorations, one vector per thread
     std::vector<std::vector<bool>> visitedGlobal;
 
-    tlx::d_ary_addressable_int_heap<node, 2, Aux::GreaterInVector<double>> candidateNodesPQ;
+    // Candidates keyed by the upper bounds in margGain
+    LazyGreedy greedy;
     std::vector<tlx::d_ary_addressable_int_heap<node, 2, Aux::LessInVector<WeightType>>>
         dijkstraHeaps;
 
@@ -101,7 +102,7 @@ constexpr WeightType GroupHarmonicClosenessImpl<WeightType>::infDist;
 
 template <class WeightType>
 GroupHarmonicClosenessImpl<WeightType>::GroupHarmonicClosenessImpl(const Graph &G, count k)
-    : G(&G), k(k), candidateNodesPQ{Aux::GreaterInVector<double>(margGain)} {
+    : G(&G), k(k), greedy(margGain) {
 
     if (k == 0 || G.numberOfNodes() <= k)
         throw std::runtime_error("Error, k must be in [1, n - 1]");
@@ -121,7 +122,6 @@ GroupHarmonicClosenessImpl<WeightType>::GroupHarmonicClosenessImpl(const Graph &
     for (omp_index i = 0; i < t; ++i)
         curNearerNodesGlobal[i].reserve(n - 1);
 
-    candidateNodesPQ.reserve(n);
     if (G.isWeighted()) {
         dijkstraHeaps.reserve(t);
         for (omp_index i = 0; i < t; ++i) {
@@ -505,50 +505,21 @@ SSSPResult GroupHarmonicClosenessImpl<edgeweight>::prunedSSSP(node source, doubl
 
 template <class WeightType>
 node GroupHarmonicClosenessImpl<WeightType>::findTopHarmonicCloseness() {
-    node bestNode = *G->nodeRange().begin();
-    double bestScore = 0;
-    candidateNodesPQ.build_heap(G->nodeRange().begin(), G->nodeRange().end());
-
-    std::atomic<bool> stop{false};
-
-#pragma omp parallel
-    {
-        while (!stop.load(std::memory_order_relaxed)) {
-            node u = none;
-
-#pragma omp critical
-            {
-                if (candidateNodesPQ.empty()) {
-                    stop.store(true, std::memory_order_relaxed);
-                } else {
-                    u = candidateNodesPQ.extract_top();
-                    if (margGain[u] <= bestScore) {
-                        stop.store(true, std::memory_order_relaxed);
-                        u = none;
-                    }
-                }
-            }
-
-            if (u == none)
-                break;
+    greedy.setCandidates(G->nodeRange().begin(), G->nodeRange().end());
 
+    const node bestNode = greedy.selectNext(
+        [&](node u, double bestScore) {
             const auto ssspResult = prunedSSSPEmptyGroup(u, bestScore);
-            margGain[u] = ssspResult.score;
-#pragma omp critical
-            {
-                if (ssspResult.complete && ssspResult.score > bestScore) {
-                    bestNode = u;
-                    bestScore = ssspResult.score;
-                    std::swap(curDistGlobal[omp_get_thread_num()], distFromGroup);
+            return LazyGreedy::Evaluation{ssspResult.score, ssspResult.complete};
+        },
+        [&]([[maybe_unused]] node u) {
+            std::swap(curDistGlobal[omp_get_thread_num()], distFromGroup);
 #ifdef NETWORKIT_SANITY_CHECKS
-                    group.push_back(bestNode);
-                    checkDistFromGroup();
-                    group.clear();
+            group.push_back(u);
+            checkDistFromGroup();
+            group.clear();
 #endif // NETWORKIT_SANITY_CHECKS
-                }
-            }
-        }
-    }
+        });
 
     if (!G->isDirected() && !G->isWeighted())
         reachableNodesInComponent[component.subsetOf(bestNode)] -= G->degree(bestNode) + 1;
@@ -557,53 +528,28 @@ node GroupHarmonicClosenessImpl<WeightType>::findTopHarmonicCloseness() {
 
 template <class WeightType>
 node GroupHarmonicClosenessImpl<WeightType>::findNodeWithHighestMargGain() {
-    node bestNode = none;
-    double bestScore = -std::numeric_limits<double>::max();
     if (!G->isDirected())
         G->forNodes([&](node u) {
             if (distFromGroup[u] > 0)
                 margGain[u] = std::min(margGain[u], harmonicClosenessUBUndirected(u));
         });
 
-    candidateNodesPQ.build_heap(G->nodeRange().begin(), G->nodeRange().end());
-    for (node u : group)
-        candidateNodesPQ.remove(u);
-
-    std::atomic<bool> stop{false};
-#pragma omp parallel
-    {
-        while (!stop.load(std::memory_order_relaxed)) {
-            node u = none;
-#pragma omp critical
-            {
-                if (candidateNodesPQ.empty()) {
-                    stop.store(true, std::memory_order_relaxed);
-                } else {
-                    u = candidateNodesPQ.extract_top();
-                    if (margGain[u] <= bestScore) {
-                        stop.store(true, std::memory_order_relaxed);
-                        u = none;
-                    }
-                }
-            }
-
-            if (u == none)
-                break;
+    // The bounds of undirected graphs may have been lowered, so the candidates must be rebuilt
+    if (!G->isDirected()) {
+        greedy.setCandidates(G->nodeRange().begin(), G->nodeRange().end());
+        for (node u : group)
+            greedy.removeCandidate(u);
+    }
 
+    const node bestNode = greedy.selectNext(
+        [&](node u, double bestScore) {
             const auto ssspResult = prunedSSSP(u, bestScore);
-            margGain[u] = ssspResult.score;
-
-#pragma omp critical
-            {
-                if (ssspResult.complete && ssspResult.score > bestScore) {
-                    bestNode = u;
-                    bestScore = ssspResult.score;
-                    std::swap(curDistGlobal[omp_get_thread_num()], curBestDist);
-                    std::swap(curNearerNodesGlobal[omp_get_thread_num()], nearerNodes);
-                }
-            }
-        }
-    }
+            return LazyGreedy::Evaluation{ssspResult.score, ssspResult.complete};
+        },
+        [&](node) {
+            std::swap(curDistGlobal[omp_get_thread_num()], curBestDist);
+            std::swap(curNearerNodesGlobal[omp_get_thread_num()], nearerNodes);
+        });
 
     assert(bestNode != none);
     for (const node u : nearerNodes) {
@@ -6,6 +6,7 @@
  *             Alexander van der Grinten <avdgrinten@hu-berlin.de>
  */
 
+#include <algorithm>
 #include <cmath>
 #include <deque>
 #include <limits>
@@ -14,6 +15,7 @@
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/auxiliary/Parallelism.hpp>
 #include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/Timer.hpp>
 #include <networkit/centrality/KadabraBetweenness.hpp>
 #include <networkit/distance/Diameter.hpp>
 
@@ -243,16 +245,11 @@ void KadabraBetweenness::init() {
     approxSum.resize(n, 0);
     deltaLGuess.resize(n, 0);
     deltaUGuess.resize(n, 0);
-    if (!G.isDirected()) {
-        this->cc = std::make_unique<ConnectedComponents>(G);
-        this->cc->run();
-    }
+    engine = std::make_unique<PathSamplingEngine>(G);
+    engine->initSamplers();
     epochFinished = std::vector<std::atomic<StateFrame *>>(omp_max_threads);
-    samplerVec.reserve(omp_max_threads);
-    for (count i = 0; i < omp_max_threads; ++i) {
-        samplerVec.emplace_back(G, *cc);
+    for (count i = 0; i < omp_max_threads; ++i)
         epochFinished[i].store(nullptr, std::memory_order_relaxed);
-    }
 
     maxFrames.resize(omp_max_threads, 0);
 }
@@ -330,8 +327,9 @@ void KadabraBetweenness::run() {
 #pragma omp parallel for schedule(dynamic)
     for (omp_index i = 0; i < static_cast<omp_index>(tau); ++i) {
         auto t = omp_get_thread_num();
-        samplerVec[t].rng.seed(seed0 ^ i);
-        samplerVec[t].randomPath(&firstFrames[t]);
+        auto &sampler = engine->getSampler(t);
+        sampler.seed(seed0 ^ i);
+        sampler.randomPath(firstFrames[t].apx);
     }
 
     nPairs = tau;
@@ -351,10 +349,12 @@ void KadabraBetweenness::run() {
         top->clear();
 
     Status status(unionSample);
+    Aux::Timer timer;
+    timer.start();
 #pragma omp parallel
     {
         const omp_index t = omp_get_thread_num();
-        SpSampler &sampler = samplerVec[t];
+        ShortestPathSampler &sampler = engine->getSampler(t);
         std::deque<StateFrame *> unused;
         int32_t epochToWrite = 0;
         StateFrame *curFrame = &firstFrames[t];
@@ -374,7 +374,7 @@ void KadabraBetweenness::run() {
                 unused.pop_front();
             }
             curFrame->reset(epochToWrite);
-            sampler.rng.seed(seed1 ^ (epochToWrite * omp_get_max_threads() + t));
+            sampler.seed(seed1 ^ (epochToWrite * omp_get_max_threads() + t));
         };
 
         auto recycleFrame = [&]() {
@@ -384,7 +384,7 @@ void KadabraBetweenness::run() {
             }
         };
 
-        sampler.rng.seed(seed1 ^ (epochToWrite * omp_get_max_threads() + t));
+        sampler.seed(seed1 ^ (epochToWrite * omp_get_max_threads() + t));
         while (!stop.load(std::memory_order_relaxed)) {
             // Reader thread
             if (t == 0) {
@@ -410,7 +410,7 @@ void KadabraBetweenness::run() {
             }
 
             for (unsigned int i = 0; i < itersPerStep; ++i) {
-                sampler.randomPath(curFrame);
+                sampler.randomPath(curFrame->apx);
             }
             curFrame->nPairs += itersPerStep;
 
@@ -424,6 +424,9 @@ void KadabraBetweenness::run() {
         // allocated frames
 #pragma omp barrier
     }
+    timer.stop();
+    samplesPerSecond =
+        static_cast<double>(nPairs) / std::max(1e-9, timer.elapsedNanoseconds() * 1e-9);
 
 #pragma omp parallel for
     for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
@@ -478,170 +481,4 @@ void KadabraBetweenness::checkConvergence(Status &status) {
     }
 }
 
-SpSampler::SpSampler(const Graph &G, const ConnectedComponents &cc) : G(G), cc(cc), rng(0) {
-    const auto n = G.upperNodeIdBound();
-    distr = std::uniform_int_distribution<node>(0, n - 1);
-    q.resize(n);
-    timestamp.assign(n, 0);
-    dist.assign(n, std::numeric_limits<count>::max());
-    nPaths.resize(n);
-}
-
-void SpSampler::randomPath(StateFrame *curFrame) {
-    frame = curFrame;
-    node u = distr(rng);
-    node v = distr(rng);
-    while (u == v)
-        v = distr(rng);
-
-    if (!G.isDirected() && cc.componentOfNode(u) != cc.componentOfNode(v))
-        return;
-
-    count endQ = 2;
-    q[0] = u;
-    q[1] = v;
-
-    timestamp[u] = globalTS;
-    // Setting 8-th bit to 1 (i.e. ball indicator for nodes visited from
-    // target).
-    timestamp[v] = globalTS + ballMask;
-
-    dist[u] = 0;
-    dist[v] = 0;
-    nPaths[u] = 1;
-    nPaths[v] = 1;
-
-    spEdges.clear();
-
-    node x, randomEdge;
-    bool hasToStop = false, useDegreeIn;
-    count startU = 0, startV = 1, endU = 1, endV = 2, startCur, endCur, *newEndCur;
-    count sumDegsU = 0, sumDegsV = 0, *sumDegsCur;
-    count totWeight = 0, curEdge = 0;
-
-    auto procNeighbor = [&](const node x, const node y) {
-        // Node not visited
-        if ((timestamp[y] & stampMask) != globalTS) {
-            (*sumDegsCur) += getDegree(G, y, useDegreeIn);
-            nPaths[y] = nPaths[x];
-            timestamp[y] = globalTS + (timestamp[x] & ballMask);
-            q[endQ++] = y;
-            ++(*newEndCur);
-            dist[y] = dist[x] + 1;
-        } else if ((timestamp[x] & ballMask) != (timestamp[y] & ballMask)) {
-            hasToStop = true;
-            spEdges.emplace_back(x, y);
-        } else if (dist[y] == dist[x] + 1) {
-            nPaths[y] += nPaths[x];
-        }
-    };
-
-    while (!hasToStop) {
-        if (sumDegsU <= sumDegsV) {
-            startCur = startU;
-            endCur = endU;
-            startU = endQ;
-            newEndCur = &endU;
-            endU = endQ;
-            sumDegsU = 0;
-            sumDegsCur = &sumDegsU;
-            useDegreeIn = false;
-        } else {
-            startCur = startV;
-            endCur = endV;
-            startV = endQ;
-            newEndCur = &endV;
-            endV = endQ;
-            sumDegsV = 0;
-            sumDegsCur = &sumDegsV;
-            useDegreeIn = true;
-        }
-
-        while (startCur < endCur) {
-            x = q[startCur++];
-
-            if (useDegreeIn)
-                G.forInNeighborsOf(x, [&](const node y) { procNeighbor(x, y); });
-            else
-                G.forNeighborsOf(x, [&](const node y) { procNeighbor(x, y); });
-        }
-
-        if (*sumDegsCur == 0)
-            hasToStop = true;
-    }
-
-    ++globalTS;
-
-    if (spEdges.empty()) {
-        resetSampler(endQ);
-        if (globalTS == 128) {
-            globalTS = 1;
-            std::fill(timestamp.begin(), timestamp.end(), 0);
-        }
-        return;
-    }
-
-    for (auto p : spEdges)
-        totWeight += nPaths[p.first] * nPaths[p.second];
-
-    std::uniform_int_distribution<node> wDistr(0, totWeight - 1);
-    randomEdge = wDistr(rng);
-
-    for (auto p : spEdges) {
-        curEdge += nPaths[p.first] * nPaths[p.second];
-        if (curEdge > randomEdge) {
-            backtrackPath(u, v, p.first);
-            backtrackPath(u, v, p.second);
-            break;
-        }
-    }
-
-    if (globalTS == 128) {
-        globalTS = 1;
-        std::fill(timestamp.begin(), timestamp.end(), 0);
-    }
-
-    resetSampler(endQ);
-}
-
-void SpSampler::backtrackPath(const node source, const node target, const node start) {
-    if (start == target || start == source)
-        return;
-
-    frame->apx[start] += 1;
-    count totWeight = nPaths[start];
-    std::uniform_int_distribution<node> wDistr(0, totWeight - 1);
-    const node randomPred = wDistr(rng);
-
-    node curPred = 0, w = 0;
-    bool stop = false;
-    // TODO: update this in the case of directed graphs (use inNeighbors if
-    // ballind is 0x80)
-    G.forNeighborsOf(start, [&](const node t) {
-        if (!stop) {
-            if (dist[t] == dist[start] - 1
-                && ((timestamp[start] & ballMask) == (timestamp[t] & ballMask))) {
-                w = t;
-                curPred += nPaths[target];
-                if (curPred > randomPred) {
-                    stop = true;
-                }
-            }
-        }
-    });
-
-    if (w != source && w != target)
-        backtrackPath(source, target, w);
-}
-
-void SpSampler::resetSampler(const count endQ) {
-    for (count i = 0; i < endQ; ++i) {
-        dist[q[i]] = std::numeric_limits<count>::max();
-        nPaths[q[i]] = 0;
-    }
-}
-
-count SpSampler::getDegree(const Graph &graph, node z, bool useDegreeIn) {
-    return useDegreeIn ? graph.degreeIn(z) : graph.degree(z);
-}
 } // namespace NetworKit
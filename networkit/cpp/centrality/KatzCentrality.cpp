@@ -8,6 +8,7 @@
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/centrality/KatzCentrality.hpp>
+#include <networkit/centrality/PowerIteration.hpp>
 #include <networkit/graph/GraphTools.hpp>
 
 namespace NetworKit {
@@ -24,6 +25,10 @@ KatzCentrality::KatzCentrality(const Graph &G, double alpha, double beta, double
 }
 
 void KatzCentrality::run() {
+    if (edgeDirection != EdgeDirection::OUT_EDGES && edgeDirection != EdgeDirection::IN_EDGES)
+        throw std::runtime_error("Unsupported edge direction");
+
+    const PowerIteration spmv(G, edgeDirection == EdgeDirection::IN_EDGES);
     std::fill(values.begin(), values.end(), 1.0);
     values.resize(G.upperNodeIdBound(), 1.0);
     scoreData = values;
@@ -35,32 +40,20 @@ void KatzCentrality::run() {
         return Aux::NumericTools::equal(val, other, tol);
     };
 
-    auto updateScore = [&](node u, node v, edgeweight ew, edgeid) -> void {
-        values[u] += ew * alpha * (1 + scoreData[v]);
-    };
+    // alpha * sum of ew * (1 + scoreData[v]) is split into alpha * (sum of ew * scoreData[v])
+    // plus alpha * (sum of ew), the latter is computed once from the all-ones start vector
+    std::vector<double> weightSum(G.upperNodeIdBound(), 0.0);
+    spmv.multiply(scoreData, weightSum, [](node, double sum) { return sum; });
 
     do {
         oldLength = length;
 
         // iterate matrix-vector product
-        G.parallelForNodes([&](node u) {
-            values[u] = 0.0;
-
-            if (edgeDirection == EdgeDirection::OUT_EDGES)
-                G.forNeighborsOf(u, updateScore);
-            else if (edgeDirection == EdgeDirection::IN_EDGES)
-                G.forInNeighborsOf(u, updateScore);
-            else
-                throw std::runtime_error("Unsupported edge direction");
-
-            values[u] += beta;
-        });
-
-        // normalize values
-        length = G.parallelSumForNodes([&](node u) { return values[u] * values[u]; });
-        length = std::sqrt(length);
+        length = spmv.multiply(scoreData, values, [&](node u, double sum) {
+                         return alpha * (sum + weightSum[u]) + beta;
+                     }).norm();
 
-        scoreData = values;
+        std::swap(scoreData, values);
         INFO("oldLength: ", oldLength, ", length: ", length);
     } while (!converged(length, oldLength));
 
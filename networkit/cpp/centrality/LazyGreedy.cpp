@@ -0,0 +1,21 @@
+/*
+ * LazyGreedy.cpp
+ *
+ * Lazy greedy maximization shared by the group centrality algorithms.
+ */
+
+#include <networkit/centrality/LazyGreedy.hpp>
+
+namespace NetworKit {
+
+LazyGreedy::LazyGreedy(std::vector<double> &bounds)
+    : bounds(&bounds), heap{Aux::GreaterInVector<double>(bounds)} {
+    heap.reserve(bounds.size());
+    omp_init_lock(&lock);
+}
+
+LazyGreedy::~LazyGreedy() {
+    omp_destroy_lock(&lock);
+}
+
+} // namespace NetworKit
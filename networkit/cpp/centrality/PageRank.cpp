@@ -10,6 +10,7 @@
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/centrality/PageRank.hpp>
+#include <networkit/centrality/PowerIteration.hpp>
 
 namespace NetworKit {
 
@@ -28,8 +29,15 @@ void PageRank::run() {
     scoreData.resize(z, 1.0 / static_cast<double>(n));
     std::vector<double> pr = scoreData;
 
-    std::vector<double> deg(z, 0.0);
-    G.parallelForNodes([&](const node u) { deg[u] = static_cast<double>(G.weightedDegree(u)); });
+    // note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs we
+    // follow the verbal description, which requires to sum over the incoming edges
+    PowerIteration spmv(G);
+    {
+        std::vector<double> deg(z, 0.0);
+        G.parallelForNodes(
+            [&](const node u) { deg[u] = static_cast<double>(G.weightedDegree(u)); });
+        spmv.scaleColumns([&](const node v) { return 1.0 / deg[v]; });
+    }
 
     std::vector<node> sinks;
     if (G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized)) {
@@ -43,55 +51,27 @@ void PageRank::run() {
 
     iterations = 0;
 
-    auto sumL1Norm = [&](const node u) { return std::abs(scoreData[u] - pr[u]); };
-
-    auto sumL2Norm = [&](const node u) {
-        const auto d = scoreData[u] - pr[u];
-        return d * d;
-    };
-
-    auto converged([&]() {
-        if (iterations >= maxIterations) {
-            return true;
-        }
-
-        if (norm == Norm::L2_NORM) {
-            return std::sqrt(G.parallelSumForNodes(sumL2Norm)) <= tol;
-        }
-
-        return G.parallelSumForNodes(sumL1Norm) <= tol;
-    });
-
     bool isConverged = false;
     do {
         handler.assureRunning();
-        G.balancedParallelForNodes([&](const node u) {
-            pr[u] = 0.0;
-            G.forInEdgesOf(u, [&](const node u, const node v, const edgeweight w) {
-                // note: inconsistency in definition in Newman's book (Ch. 7) regarding directed
-                // graphs we follow the verbal description, which requires to sum over the incoming
-                // edges
-                pr[u] += scoreData[v] * w / deg[v];
-            });
-            pr[u] *= damp;
-            pr[u] += teleportProb;
-        });
 
         // For directed graphs sink-handling is needed to fulfill |pr| == 1 in each step. Otherwise
         // probability mass would be leaked, creating wrong results. For this, we add edges from
         // sinks to all other nodes. This is described amongst others in "PageRank revisited."
         // by M. Brinkmeyer et al. (2005).
-        if (G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized)) {
-            double totalSinkContrib = 0.0;
+        double totalSinkContrib = 0.0;
 #pragma omp parallel for reduction(+ : totalSinkContrib)
-            for (omp_index i = 0; i < static_cast<omp_index>(nSinks); i++) {
-                totalSinkContrib += factor * scoreData[sinks[i]];
-            }
-            G.balancedParallelForNodes([&](const node u) { pr[u] += totalSinkContrib; });
+        for (omp_index i = 0; i < static_cast<omp_index>(nSinks); i++) {
+            totalSinkContrib += factor * scoreData[sinks[i]];
         }
 
+        const auto step = spmv.multiply(scoreData, pr, [&](node, double sum) {
+            return damp * sum + teleportProb + totalSinkContrib;
+        });
+
         ++iterations;
-        isConverged = converged();
+        isConverged = iterations >= maxIterations
+                      || (norm == Norm::L2_NORM ? step.l2Diff() : step.l1Diff()) <= tol;
         std::swap(pr, scoreData);
     } while (!isConverged);
 
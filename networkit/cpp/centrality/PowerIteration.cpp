@@ -0,0 +1,35 @@
+/*
+ * PowerIteration.cpp
+ *
+ * Power iteration kernel shared by the spectral centralities.
+ */
+
+#include <networkit/centrality/PowerIteration.hpp>
+
+namespace NetworKit {
+
+PowerIteration::PowerIteration(const Graph &G, bool inEdges) : G(&G) {
+    const count z = G.upperNodeIdBound();
+    offsets.assign(z + 1, 0);
+    G.parallelForNodes([&](node u) { offsets[u + 1] = inEdges ? G.degreeIn(u) : G.degree(u); });
+    for (index u = 0; u < z; ++u)
+        offsets[u + 1] += offsets[u];
+
+    neighbors.resize(offsets[z]);
+    weights.resize(offsets[z]);
+    G.balancedParallelForNodes([&](node u) {
+        index pos = offsets[u];
+        const auto store = [&](node, node v, edgeweight w) {
+            neighbors[pos] = v;
+            weights[pos] = w;
+            ++pos;
+        };
+        if (inEdges)
+            G.forInEdgesOf(u, store);
+        else
+            G.forEdgesOf(u, store);
+        assert(pos == offsets[u + 1]);
+    });
+}
+
+} // namespace NetworKit
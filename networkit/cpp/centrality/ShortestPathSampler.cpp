@@ -0,0 +1,239 @@
+/*
+ * ShortestPathSampler.cpp
+ *
+ * Shortest path sampling shared by the sampling-based betweenness approximations.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include <networkit/centrality/ShortestPathSampler.hpp>
+
+namespace NetworKit {
+
+ShortestPathSampler::ShortestPathSampler(const Graph &G, const ConnectedComponents *cc)
+    : G(&G), cc(cc), rng(0), distr(0, std::max<count>(G.upperNodeIdBound(), 1) - 1) {
+    const count n = G.upperNodeIdBound();
+    q.resize(n);
+    timestamp.assign(n, 0);
+    dist.assign(n, std::numeric_limits<count>::max());
+    nPaths.assign(n, 0);
+}
+
+bool ShortestPathSampler::randomPath(std::vector<count> &counts) {
+    if (G->numberOfNodes() < 2)
+        return false;
+
+    const auto randomNode = [&]() -> node {
+        node u;
+        do {
+            u = distr(rng);
+        } while (!G->hasNode(u));
+        return u;
+    };
+
+    const node u = randomNode();
+    node v = randomNode();
+    while (u == v)
+        v = randomNode();
+
+    return randomPath(u, v, counts);
+}
+
+bool ShortestPathSampler::randomPath(node source, node target, std::vector<count> &counts) {
+    if (cc && cc->componentOfNode(source) != cc->componentOfNode(target))
+        return false;
+
+    count endQ = 2;
+    q[0] = source;
+    q[1] = target;
+
+    timestamp[source] = globalTS;
+    timestamp[target] = globalTS + ballMask;
+
+    dist[source] = 0;
+    dist[target] = 0;
+    nPaths[source] = 1;
+    nPaths[target] = 1;
+
+    spEdges.clear();
+
+    bool hasToStop = false, backward = false;
+    count startU = 0, startV = 1, endU = 1, endV = 2, startCur, endCur, *newEndCur;
+    count sumDegsU = 0, sumDegsV = 0, *sumDegsCur;
+
+    auto procNeighbor = [&](const node x, const node y) {
+        if ((timestamp[y] & stampMask) != globalTS) {
+            // y has not been visited yet
+            (*sumDegsCur) += backward ? G->degreeIn(y) : G->degree(y);
+            nPaths[y] = nPaths[x];
+            timestamp[y] = globalTS + (timestamp[x] & ballMask);
+            q[endQ++] = y;
+            ++(*newEndCur);
+            dist[y] = dist[x] + 1;
+        } else if ((timestamp[x] & ballMask) != (timestamp[y] & ballMask)) {
+            // the two searches met
+            hasToStop = true;
+            spEdges.emplace_back(x, y);
+        } else if (dist[y] == dist[x] + 1) {
+            nPaths[y] += nPaths[x];
+        }
+    };
+
+    while (!hasToStop) {
+        if (sumDegsU <= sumDegsV) {
+            startCur = startU;
+            endCur = endU;
+            startU = endQ;
+            newEndCur = &endU;
+            endU = endQ;
+            sumDegsU = 0;
+            sumDegsCur = &sumDegsU;
+            backward = false;
+        } else {
+            startCur = startV;
+            endCur = endV;
+            startV = endQ;
+            newEndCur = &endV;
+            endV = endQ;
+            sumDegsV = 0;
+            sumDegsCur = &sumDegsV;
+            backward = true;
+        }
+
+        while (startCur < endCur) {
+            const node x = q[startCur++];
+            if (backward)
+                G->forInNeighborsOf(x, [&](const node y) { procNeighbor(x, y); });
+            else
+                G->forNeighborsOf(x, [&](const node y) { procNeighbor(x, y); });
+        }
+
+        if (*sumDegsCur == 0)
+            hasToStop = true;
+    }
+
+    const bool found = !spEdges.empty();
+    if (found) {
+        // Pick the edge where the two searches meet with probability proportional to the
+        // number of shortest paths through it, then backtrack to source and target.
+        count totWeight = 0;
+        for (const auto &p : spEdges)
+            totWeight += nPaths[p.first] * nPaths[p.second];
+
+        std::uniform_int_distribution<count> wDistr(0, totWeight - 1);
+        const count randomEdge = wDistr(rng);
+
+        count curEdge = 0;
+        for (const auto &p : spEdges) {
+            curEdge += nPaths[p.first] * nPaths[p.second];
+            if (curEdge > randomEdge) {
+                backtrackPath(p.first, counts);
+                backtrackPath(p.second, counts);
+                break;
+            }
+        }
+    }
+
+    resetSampler(endQ);
+    return found;
+}
+
+void ShortestPathSampler::backtrackPath(node start, std::vector<count> &counts) {
+    // Every node reached by a search has a predecessor in the same search unless it is the
+    // source or the target of the path.
+    while (dist[start] > 0) {
+        ++counts[start];
+
+        const uint8_t ball = timestamp[start] & ballMask;
+        std::uniform_int_distribution<count> wDistr(0, nPaths[start] - 1);
+        const count randomPred = wDistr(rng);
+
+        // Choose a predecessor with probability proportional to its number of shortest paths.
+        node pred = none;
+        count curPred = 0;
+        const auto visit = [&](const node t) {
+            if (pred != none || dist[t] + 1 != dist[start] || (timestamp[t] & ballMask) != ball
+                || (timestamp[t] & stampMask) != globalTS)
+                return;
+            curPred += nPaths[t];
+            if (curPred > randomPred)
+                pred = t;
+        };
+
+        // The search from the source reached start via an in-edge, the search from the target
+        // via an out-edge.
+        if (ball)
+            G->forNeighborsOf(start, visit);
+        else
+            G->forInNeighborsOf(start, visit);
+
+        assert(pred != none);
+        start = pred;
+    }
+}
+
+void ShortestPathSampler::resetSampler(count endQ) {
+    for (count i = 0; i < endQ; ++i) {
+        dist[q[i]] = std::numeric_limits<count>::max();
+        nPaths[q[i]] = 0;
+    }
+
+    if (++globalTS == 128) {
+        globalTS = 1;
+        std::fill(timestamp.begin(), timestamp.end(), 0);
+    }
+}
+
+PathSamplingEngine::PathSamplingEngine(const Graph &G, bool parallel)
+    : G(&G), threads(parallel ? omp_get_max_threads() : 1) {}
+
+void PathSamplingEngine::initSamplers() {
+    if (!samplers.empty())
+        return;
+
+    if (!G->isDirected()) {
+        cc = std::make_unique<ConnectedComponents>(*G);
+        cc->run();
+    }
+
+    samplers.reserve(threads);
+    for (count i = 0; i < threads; ++i)
+        samplers.emplace_back(*G, cc.get());
+}
+
+std::vector<count> PathSamplingEngine::samplePaths(count samples, uint64_t seed) {
+    initSamplers();
+    const count n = G->upperNodeIdBound();
+    std::vector<std::vector<count>> localCounts(threads);
+
+    Aux::Timer timer;
+    timer.start();
+#pragma omp parallel num_threads(threads)
+    {
+        const index t = omp_get_thread_num();
+        auto &counts = localCounts[t];
+        counts.resize(n);
+        samplers[t].seed(seed ^ t);
+#pragma omp for schedule(dynamic, 16)
+        for (omp_index i = 0; i < static_cast<omp_index>(samples); ++i)
+            samplers[t].randomPath(counts);
+    }
+    timer.stop();
+    recordThroughput(samples, timer);
+
+    std::vector<count> result(n);
+#pragma omp parallel for
+    for (omp_index v = 0; v < static_cast<omp_index>(n); ++v)
+        for (const auto &counts : localCounts)
+            if (!counts.empty())
+                result[v] += counts[v];
+    return result;
+}
+
+void PathSamplingEngine::recordThroughput(count samples, const Aux::Timer &timer) {
+    const double seconds = static_cast<double>(timer.elapsedNanoseconds()) * 1e-9;
+    throughput = seconds > 0 ? static_cast<double>(samples) / seconds : 0;
+}
+
+} // namespace NetworKit
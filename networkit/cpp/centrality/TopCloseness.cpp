@@ -5,6 +5,7 @@
  *      Author: ebergamini, michele borassi
  */
 
+#include <algorithm>
 #include <omp.h>
 #include <queue>
 #include <stack>
@@ -12,6 +13,7 @@
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/VectorComparator.hpp>
 #include <networkit/centrality/TopCloseness.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 #include <networkit/graph/BFS.hpp>
 #include <networkit/reachability/ReachableNodes.hpp>
 
@@ -39,7 +41,7 @@ void TopCloseness::init() {
     DEBUG("k = ", k);
     farness.clear();
     farness.resize(n, 0);
-    if (sec_heu) {
+    if (sec_heu && !batchedBFS) {
         nodesPerLevs.resize(omp_get_max_threads(), std::vector<count>(n));
         sumLevels.resize(omp_get_max_threads(), std::vector<count>(n));
     }
@@ -319,6 +321,55 @@ double TopCloseness::BFScut(node v, double x, std::vector<bool> &visited,
     return farnessV;
 }
 
+void TopCloseness::batchBFScut(const std::vector<node> &batch, double x, MultiSourceBFS &msbfs,
+                               count &visEdges) {
+    using Mask = MultiSourceBFS::Mask;
+    const count b = batch.size();
+    const auto &reachL = *reachLPtr, &reachU = *reachUPtr;
+    std::vector<count> nd(b, 1);
+    std::vector<double> sumDist(b, 0);
+    Mask finished = 0;
+
+    msbfs.run(batch, [&](count level, const std::array<count, MultiSourceBFS::maxSources> &found) {
+        visEdges += G.isDirected() ? G.numberOfEdges() : 2 * G.numberOfEdges();
+        Mask stop = 0;
+        for (index i = 0; i < b; ++i) {
+            const Mask bit = Mask{1} << i;
+            if (finished & bit)
+                continue;
+
+            const node s = batch[i];
+            if (!found[i]) { // The BFS from s is complete.
+                // Like nodes without out-edges, a node whose only edges are self-loops reaches
+                // no other node.
+                farness[s] = (nd[i] == 1) ? std::numeric_limits<double>::max()
+                                          : sumDist[i] * static_cast<double>(n - 1)
+                                                / static_cast<double>(nd[i] - 1)
+                                                / static_cast<double>(nd[i] - 1);
+                finished |= bit;
+                continue;
+            }
+
+            nd[i] += found[i];
+            sumDist[i] += static_cast<double>(level * found[i]);
+
+            // All nodes that have not been visited yet have distance at least level + 1.
+            const auto bound = [&](double r) {
+                r = std::max(r, static_cast<double>(nd[i]));
+                return (sumDist[i] + static_cast<double>(level + 1) * (r - nd[i]))
+                       * static_cast<double>(n - 1) / (r - 1.0) / (r - 1.0);
+            };
+            const double farnessL = std::min(bound(reachL[s]), bound(reachU[s]));
+            if (farnessL > x) {
+                farness[s] = farnessL;
+                finished |= bit;
+                stop |= bit;
+            }
+        }
+        return stop;
+    });
+}
+
 void TopCloseness::run() {
     init();
     tlx::d_ary_heap<node, 2, Aux::GreaterInVector<double>> top{farness};
@@ -375,138 +426,169 @@ void TopCloseness::run() {
     }
 
     double kth = std::numeric_limits<double>::max(); // like in Crescenzi
-#pragma omp parallel                                 // Shared variables:
-    // cc: synchronized write, read leads to a positive race condition;
-    // Q: fully synchronized;
-    // top: fully synchronized;
-    // toAnalyze: fully synchronized;
-    // visEdges: one variable for each thread, summed at the end;
-    {
-        count visEdges = 0;
-#ifndef NETWORKIT_RELEASE_LOGGING
-        count iters = 0;
-#endif
 
-        while (!Q.empty()) {
-            DEBUG("To be analyzed: ", Q.size());
-            omp_set_lock(&lock);
-            if (Q.empty()) { // The size of Q might have changed.
-                omp_unset_lock(&lock);
-                break;
+    // Inserts s into the top-k nodes if necessary and updates kth.
+    auto updateTopK = [&](node s) {
+        if (farness[s] <= kth) {
+            DEBUG("    The closeness of s is ", 1.0 / farness[s], ".");
+            top.push(s);
+            if (top.size() > k) {
+                ++trail;
+                if (farness[s] < kth) {
+                    if (nMaxFarness == trail) {
+                        // Purging trail
+                        do {
+                            top.extract_top();
+                        } while (top.size() > k);
+
+                        trail = 0;
+                        nMaxFarness = 1;
+                        if (k > 1) {
+                            node last = top.extract_top();
+                            maxFarness = farness[last];
+                            std::stack<node> tmp;
+                            tmp.push(last);
+
+                            while (!top.empty() && farness[last] == farness[top.top()]) {
+                                tmp.push(top.extract_top());
+                                ++nMaxFarness;
+                            }
+
+                            while (!tmp.empty()) {
+                                top.push(tmp.top());
+                                tmp.pop();
+                            }
+                        }
+                    }
+                } else { // Same farness as kth
+                    ++nMaxFarness;
+                }
+            } else if (farness[s] > maxFarness) {
+                maxFarness = farness[s];
+                nMaxFarness = 1;
+            } else if (farness[s] == maxFarness) {
+                ++nMaxFarness;
             }
-            // Access to Q must be synchronized
-            node s = Q.extract_top();
-            toAnalyze[s] = false;
-            omp_unset_lock(&lock);
+        } else {
+            DEBUG("    Not in the top-k.");
+        }
 
-            if (G.degreeOut(s) == 0 || farness[s] > kth) {
-                break;
+        // We load the new value of kth.
+        if (top.size() >= k) {
+            kth = farness[top.top()];
+            if (nMaxFarness == 1) {
+                maxFarness = kth;
+            }
+        }
+    };
+
+    if (batchedBFS) {
+        // Analyze the candidates in batches, each batch shares one bit-parallel BFS.
+        MultiSourceBFS msbfs(G);
+        std::vector<node> batch;
+        batch.reserve(MultiSourceBFS::maxSources);
+        bool done = false;
+        while (!done && !Q.empty()) {
+            batch.clear();
+            while (!Q.empty() && batch.size() < MultiSourceBFS::maxSources) {
+                const node s = Q.extract_top();
+                toAnalyze[s] = false;
+                if (G.degreeOut(s) == 0 || farness[s] > kth) {
+                    done = true;
+                    break;
+                }
+                batch.push_back(s);
             }
-            DEBUG("Iteration ", ++iters, " of thread ", omp_get_thread_num());
 
-            DEBUG("    Extracted node ", s, " with priority ", farness[s], ".");
-            if (G.degreeOut(s) == 0) {
+            batchBFScut(batch, kth, msbfs, visEdges);
+            for (node s : batch)
+                updateTopK(s);
+        }
+    } else {
+#pragma omp parallel // Shared variables:
+        // cc: synchronized write, read leads to a positive race condition;
+        // Q: fully synchronized;
+        // top: fully synchronized;
+        // toAnalyze: fully synchronized;
+        // visEdges: one variable for each thread, summed at the end;
+        {
+            count visEdges = 0;
+#ifndef NETWORKIT_RELEASE_LOGGING
+            count iters = 0;
+#endif
 
+            while (!Q.empty()) {
+                DEBUG("To be analyzed: ", Q.size());
                 omp_set_lock(&lock);
+                if (Q.empty()) { // The size of Q might have changed.
+                    omp_unset_lock(&lock);
+                    break;
+                }
+                // Access to Q must be synchronized
+                node s = Q.extract_top();
                 toAnalyze[s] = false;
-                farness[s] = std::numeric_limits<double>::max();
                 omp_unset_lock(&lock);
 
-            } else if (sec_heu) {
-                // MICHELE: we use BFSbound to bound the centrality of all nodes.
-                DEBUG("    Running BFSbound.");
-                BFSbound(s, S, visEdges, toAnalyze);
-                omp_set_lock(&lock);
-                farness[s] = S[s];
-                omp_unset_lock(&lock);
-                count imp = 0;
-                for (count v = 0; v < n; v++) {
-                    if (farness[v] < S[v] && toAnalyze[v]) { // This part must be syncrhonized.
-                        omp_set_lock(&lock);
-                        if (farness[v] < S[v] && toAnalyze[v]) { // Have to check again, because the
-                                                                 // variables might have changed
-                            ++imp;
-                            farness[v] = S[v];
-                            Q.update(v);
-                        }
-                        omp_unset_lock(&lock);
-                    }
+                if (G.degreeOut(s) == 0 || farness[s] > kth) {
+                    break;
                 }
-                DEBUG("    We have improved ", imp, " bounds.");
-                tlx::unused(imp);
-            } else {
-                // MICHELE: we use BFScut to bound the centrality of s.
-                DEBUG("    Running BFScut with x=", kth, " (degree:", G.degreeOut(s), ").");
-                auto &visited = visitedVec[omp_get_thread_num()];
-                std::fill(visited.begin(), visited.end(), false);
-                auto &distances = distVec[omp_get_thread_num()];
-                auto &pred = predVec[omp_get_thread_num()];
-                const double farnessS = BFScut(s, kth, visited, distances, pred, visEdges);
-                DEBUG("    Visited edges: ", visEdges, ".");
-                omp_set_lock(&lock);
-                farness[s] = farnessS;
-                omp_unset_lock(&lock);
-            }
-
-            // If necessary, we update kth.
-            omp_set_lock(&lock);
-            if (farness[s] <= kth) {
-                DEBUG("    The closeness of s is ", 1.0 / farness[s], ".");
-                top.push(s);
-                if (top.size() > k) {
-                    ++trail;
-                    if (farness[s] < kth) {
-                        if (nMaxFarness == trail) {
-                            // Purging trail
-                            do {
-                                top.extract_top();
-                            } while (top.size() > k);
-
-                            trail = 0;
-                            nMaxFarness = 1;
-                            if (k > 1) {
-                                node last = top.extract_top();
-                                maxFarness = farness[last];
-                                std::stack<node> tmp;
-                                tmp.push(last);
-
-                                while (!top.empty() && farness[last] == farness[top.top()]) {
-                                    tmp.push(top.extract_top());
-                                    ++nMaxFarness;
-                                }
-
-                                while (!tmp.empty()) {
-                                    top.push(tmp.top());
-                                    tmp.pop();
-                                }
+                DEBUG("Iteration ", ++iters, " of thread ", omp_get_thread_num());
+
+                DEBUG("    Extracted node ", s, " with priority ", farness[s], ".");
+                if (G.degreeOut(s) == 0) {
+
+                    omp_set_lock(&lock);
+                    toAnalyze[s] = false;
+                    farness[s] = std::numeric_limits<double>::max();
+                    omp_unset_lock(&lock);
+
+                } else if (sec_heu) {
+                    // MICHELE: we use BFSbound to bound the centrality of all nodes.
+                    DEBUG("    Running BFSbound.");
+                    BFSbound(s, S, visEdges, toAnalyze);
+                    omp_set_lock(&lock);
+                    farness[s] = S[s];
+                    omp_unset_lock(&lock);
+                    count imp = 0;
+                    for (count v = 0; v < n; v++) {
+                        if (farness[v] < S[v] && toAnalyze[v]) { // This part must be syncrhonized.
+                            omp_set_lock(&lock);
+                            // Have to check again, because the variables might have changed
+                            if (farness[v] < S[v] && toAnalyze[v]) {
+                                ++imp;
+                                farness[v] = S[v];
+                                Q.update(v);
                             }
+                            omp_unset_lock(&lock);
                         }
-                    } else { // Same farness as kth
-                        ++nMaxFarness;
                     }
-                } else if (farness[s] > maxFarness) {
-                    maxFarness = farness[s];
-                    nMaxFarness = 1;
-                } else if (farness[s] == maxFarness) {
-                    ++nMaxFarness;
+                    DEBUG("    We have improved ", imp, " bounds.");
+                    tlx::unused(imp);
+                } else {
+                    // MICHELE: we use BFScut to bound the centrality of s.
+                    DEBUG("    Running BFScut with x=", kth, " (degree:", G.degreeOut(s), ").");
+                    auto &visited = visitedVec[omp_get_thread_num()];
+                    std::fill(visited.begin(), visited.end(), false);
+                    auto &distances = distVec[omp_get_thread_num()];
+                    auto &pred = predVec[omp_get_thread_num()];
+                    const double farnessS = BFScut(s, kth, visited, distances, pred, visEdges);
+                    DEBUG("    Visited edges: ", visEdges, ".");
+                    omp_set_lock(&lock);
+                    farness[s] = farnessS;
+                    omp_unset_lock(&lock);
                 }
-            } else {
-                DEBUG("    Not in the top-k.");
-            }
 
-            // We load the new value of kth.
-            if (top.size() >= k) {
-                kth = farness[top.top()];
-                if (nMaxFarness == 1) {
-                    maxFarness = kth;
-                }
+                // If necessary, we update kth.
+                omp_set_lock(&lock);
+                updateTopK(s);
+                omp_unset_lock(&lock);
             }
+            DEBUG("Number of iterations of thread ", omp_get_thread_num(), ": ", iters, " out of ",
+                  n);
+            omp_set_lock(&lock);
+            this->visEdges += visEdges;
             omp_unset_lock(&lock);
         }
-        DEBUG("Number of iterations of thread ", omp_get_thread_num(), ": ", iters, " out of ", n);
-        omp_set_lock(&lock);
-        this->visEdges += visEdges;
-        omp_unset_lock(&lock);
     }
 
     if (trail) {
@@ -13,6 +13,7 @@
 #include <queue>
 
 #include <networkit/centrality/TopHarmonicCloseness.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 #include <networkit/reachability/ReachableNodes.hpp>
 
 namespace NetworKit {
@@ -94,6 +95,8 @@ void TopHarmonicCloseness::run() {
     computeReachableNodes();
     if (useNBbound)
         runNBbound();
+    else if (batchedBFS && !G->isWeighted())
+        runNBcutBatched();
     else
         runNBcut();
 
@@ -163,6 +166,39 @@ void TopHarmonicCloseness::runNBcut() {
     }
 }
 
+void TopHarmonicCloseness::runNBcutBatched() {
+    G->parallelForNodes([&](node u) { hCloseness[u] = initialBoundNBcutUnweighted(u); });
+
+    if (!nodeListPtr || nodeListPtr->empty()) {
+        prioQ.build_heap(G->nodeRange().begin(), G->nodeRange().end());
+    } else {
+        prioQ.build_heap(nodeListPtr->begin(), nodeListPtr->end());
+    }
+
+    // The candidates are analyzed in batches, each batch shares one bit-parallel BFS.
+    MultiSourceBFS msbfs(*G);
+    std::vector<node> batch;
+    batch.reserve(MultiSourceBFS::maxSources);
+    bool stop = false;
+    while (!stop && !prioQ.empty()) {
+        const double kthCloseness = (topKNodesPQ.size() == k) ? hCloseness[topKNodesPQ.top()] : -1;
+        batch.clear();
+        while (!prioQ.empty() && batch.size() < MultiSourceBFS::maxSources) {
+            const node u = prioQ.extract_top();
+            if (hCloseness[u] < kthCloseness) {
+                stop = true;
+                break;
+            }
+            batch.push_back(u);
+        }
+
+        const auto pruned = bfscutBatch(batch, kthCloseness, msbfs);
+        for (index i = 0; i < batch.size(); ++i)
+            if (!(pruned & (MultiSourceBFS::Mask{1} << i)))
+                updateTopkPQ(batch[i]);
+    }
+}
+
 void TopHarmonicCloseness::runNBbound() {
     numberOfNodesAtLevelGlobal.resize(omp_get_max_threads(),
                                       std::vector<count>(G->numberOfNodes(), 0));
@@ -293,6 +329,50 @@ bool TopHarmonicCloseness::bfscutUnweighted(node source, double kthCloseness) {
     return true;
 }
 
+uint64_t TopHarmonicCloseness::bfscutBatch(const std::vector<node> &batch, double kthCloseness,
+                                           MultiSourceBFS &msbfs) {
+    using Mask = MultiSourceBFS::Mask;
+    const count b = batch.size();
+    std::vector<count> visitedNodes(b, 1);
+    std::vector<double> h(b, 0);
+    Mask finished = 0, pruned = 0;
+
+    msbfs.run(batch, [&](count level, const std::array<count, MultiSourceBFS::maxSources> &found) {
+        for (index i = 0; i < b; ++i) {
+            const Mask bit = Mask{1} << i;
+            if (finished & bit)
+                continue;
+
+            const node source = batch[i];
+            if (!found[i]) { // Finished the BFS
+                hCloseness[source] = h[i];
+                finished |= bit;
+                continue;
+            }
+
+            visitedNodes[i] += found[i];
+            h[i] += static_cast<double>(found[i]) / static_cast<double>(level);
+            assert(reachableNodes[source] >= visitedNodes[i]);
+
+            // All nodes that have not been visited yet have distance at least level + 1.
+            const double htilde =
+                h[i]
+                + static_cast<double>(reachableNodes[source] - visitedNodes[i])
+                      / static_cast<double>(level + 1);
+
+            // Prune BFS
+            if (htilde < kthCloseness) {
+                hCloseness[source] = htilde;
+                finished |= bit;
+                pruned |= bit;
+            }
+        }
+        return pruned;
+    });
+
+    return pruned;
+}
+
 bool TopHarmonicCloseness::bfscutWeighted(node source, double kthCloseness) {
     auto &distance = distanceGlobal[omp_get_thread_num()];
     std::fill(distance.begin(), distance.end(), std::numeric_limits<edgeweight>::max());
@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/centrality/ApproxBetweenness.hpp>
 #include <networkit/centrality/ApproxCloseness.hpp>
@@ -46,7 +47,9 @@
 #include <networkit/centrality/LocalSquareClusteringCoefficient.hpp>
 #include <networkit/centrality/PageRank.hpp>
 #include <networkit/centrality/PermanenceCentrality.hpp>
+#include <networkit/centrality/PowerIteration.hpp>
 #include <networkit/centrality/Sfigality.hpp>
+#include <networkit/centrality/ShortestPathSampler.hpp>
 #include <networkit/centrality/SpanningEdgeCentrality.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
@@ -226,6 +229,49 @@ TEST_F(CentralityGTest, testBetweennessCentralityWeighted) {
     EXPECT_NEAR(0.0, bc[7], tol);
 }
 
+TEST_F(CentralityGTest, testBetweennessMemoryBoundedModes) {
+    Aux::Random::setSeed(42, false);
+    for (bool directed : {false, true}) {
+        for (bool weighted : {false, true}) {
+            Graph G = ErdosRenyiGenerator(200, 0.03, directed).generate();
+            if (weighted) {
+                G = GraphTools::toWeighted(G);
+                G.forEdges(
+                    [&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 3)); });
+            }
+            G.indexEdges();
+
+            Betweenness reference(G, false, true);
+            reference.run();
+
+            const auto check = [&](Betweenness &bc, double tol) {
+                bc.run();
+                G.forNodes([&](node u) {
+                    EXPECT_NEAR(reference.score(u), bc.score(u), tol * (1 + reference.score(u)));
+                });
+                const auto &edgeScores = bc.edgeScores();
+                const auto &refEdgeScores = reference.edgeScores();
+                for (index e = 0; e < refEdgeScores.size(); ++e)
+                    EXPECT_NEAR(refEdgeScores[e], edgeScores[e], tol * (1 + refEdgeScores[e]));
+            };
+
+            for (count sources : {1, 2, 3}) {
+                Betweenness bounded(G, false, true);
+                bounded.setMaxConcurrentSources(sources);
+                check(bounded, 1e-9);
+            }
+
+            Betweenness singlePrecision(G, false, true);
+            singlePrecision.setSinglePrecisionDependencies(true);
+            check(singlePrecision, 1e-4);
+
+            Betweenness traversal(G, false, true);
+            traversal.setParallelTraversal(true);
+            check(traversal, 1e-9);
+        }
+    }
+}
+
 // TODO: replace by smaller graph
 TEST_F(CentralityGTest, testKatzCentralityDirected) {
     const auto G = SNAPGraphReader{}.read("input/wiki-Vote.txt");
@@ -647,6 +693,47 @@ TEST_F(CentralityGTest, testPageRankCentrality) {
     EXPECT_NEAR(0.0565, std::fabs(cen[7]), tol);
 }
 
+TEST_P(CentralityGTest, testPowerIteration) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.05, isDirected()).generate();
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::probability()); });
+    }
+    G.removeNode(7);
+
+    const count z = G.upperNodeIdBound();
+    std::vector<double> x(z), y(z, -1.0), deg(z);
+    G.forNodes([&](node u) {
+        x[u] = Aux::Random::probability();
+        deg[u] = 1.0 + static_cast<double>(G.degree(u));
+    });
+
+    for (const bool inEdges : {true, false}) {
+        PowerIteration spmv(G, inEdges);
+        spmv.scaleColumns([&](node v) { return 1.0 / deg[v]; });
+        const auto step = spmv.multiply(x, y, [](node u, double sum) { return sum + u; });
+
+        double squaredNorm = 0, squaredDiff = 0, absDiff = 0;
+        G.forNodes([&](node u) {
+            double expected = static_cast<double>(u);
+            const auto pull = [&](node, node v, edgeweight w) { expected += w * x[v] / deg[v]; };
+            if (inEdges)
+                G.forInEdgesOf(u, pull);
+            else
+                G.forEdgesOf(u, pull);
+            EXPECT_NEAR(y[u], expected, 1e-9);
+            squaredNorm += expected * expected;
+            squaredDiff += (expected - x[u]) * (expected - x[u]);
+            absDiff += std::abs(expected - x[u]);
+        });
+        EXPECT_EQ(y[7], -1.0);
+        EXPECT_NEAR(step.squaredNorm, squaredNorm, 1e-6);
+        EXPECT_NEAR(step.squaredDiff, squaredDiff, 1e-6);
+        EXPECT_NEAR(step.l1Diff(), absDiff, 1e-6);
+    }
+}
+
 TEST_F(CentralityGTest, benchSequentialBetweennessCentralityOnRealGraph) {
     METISGraphReader reader;
     Graph G = reader.read("input/celegans_metabolic.graph");
@@ -1674,6 +1761,50 @@ TEST_F(CentralityGTest, testGroupCloseness) {
     EXPECT_NEAR(gc.scoreOfGroup(apx), 1.0, 1e-5);
 }
 
+TEST_P(CentralityGTest, testLazyGreedyGroupCentralities) {
+    // Checks that every group member has the highest marginal gain w.r.t. the previous members.
+    const auto checkGreedy = [](const Graph &G, const std::vector<node> &group, auto score) {
+        std::vector<node> prefix(group.begin(), group.begin() + 1);
+        for (index i = 1; i < group.size(); ++i) {
+            double best = -std::numeric_limits<double>::max();
+            G.forNodes([&](node v) {
+                if (std::find(prefix.begin(), prefix.end(), v) != prefix.end())
+                    return;
+                prefix.push_back(v);
+                best = std::max(best, score(prefix));
+                prefix.pop_back();
+            });
+            prefix.push_back(group[i]);
+            EXPECT_DOUBLE_EQ(score(prefix), best);
+        }
+    };
+
+    Aux::Random::setSeed(42, false);
+    const count k = 10;
+
+    if (!isDirected()) {
+        const Graph G = DorogovtsevMendesGenerator(200).generate();
+        GroupCloseness gc(G, k);
+        gc.run();
+        const auto group = gc.groupMaxCloseness();
+        EXPECT_EQ(std::unordered_set<node>(group.begin(), group.end()).size(), k);
+        checkGreedy(G, group,
+                    [&](const std::vector<node> &S) { return -gc.computeFarness(S); });
+    }
+
+    const Graph G = ErdosRenyiGenerator(200, 0.02, isDirected()).generate();
+    for (const bool countGroupNodes : {false, true}) {
+        GroupDegree gd(G, k, countGroupNodes);
+        gd.run();
+        const auto group = gd.groupMaxDegree();
+        EXPECT_EQ(std::unordered_set<node>(group.begin(), group.end()).size(), k);
+        EXPECT_EQ(gd.getScore(), gd.scoreOfGroup(group));
+        checkGreedy(G, group, [&](const std::vector<node> &S) {
+            return static_cast<double>(gd.scoreOfGroup(S));
+        });
+    }
+}
+
 /**
  * This test succeeds with the fixed random seed (42).
  * However, the Kadabra algorithm computes a correct epsilon-approximation of
@@ -1775,6 +1906,67 @@ TEST_F(CentralityGTest, testKadabraAbsoluteDeterministic) {
     }
 }
 
+TEST_F(CentralityGTest, testShortestPathSamplerDirected) {
+    /* Graph (directed):
+       0 -> 1 -> {2, 3} -> 6
+       0 -> 4 -> 5 -> 6
+       6 -> 4 would be a shortcut if edge directions were ignored.
+    */
+    Graph G(7, false, true);
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+    G.addEdge(1, 3);
+    G.addEdge(2, 6);
+    G.addEdge(3, 6);
+    G.addEdge(0, 4);
+    G.addEdge(4, 5);
+    G.addEdge(5, 6);
+    G.addEdge(6, 4);
+
+    ShortestPathSampler sampler(G);
+    sampler.seed(42);
+    std::vector<count> counts(G.upperNodeIdBound());
+    const count samples = 3000;
+    for (count i = 0; i < samples; ++i)
+        EXPECT_TRUE(sampler.randomPath(0, 6, counts));
+    EXPECT_FALSE(sampler.randomPath(6, 0, counts));
+
+    // All shortest paths have two inner nodes, two of the three paths use node 1.
+    EXPECT_EQ(counts[0], 0u);
+    EXPECT_EQ(counts[6], 0u);
+    EXPECT_EQ(counts[1] + counts[4], samples);
+    EXPECT_EQ(counts[1], counts[2] + counts[3]);
+    EXPECT_EQ(counts[4], counts[5]);
+    EXPECT_NEAR(static_cast<double>(counts[1]) / samples, 2. / 3., 0.05);
+    EXPECT_NEAR(static_cast<double>(counts[2]) / samples, 1. / 3., 0.05);
+}
+
+TEST_F(CentralityGTest, testPathSamplingEngine) {
+    Aux::Random::setSeed(42, false);
+    for (bool directed : {false, true}) {
+        Graph G = ErdosRenyiGenerator(100, 0.05, directed).generate();
+
+        Betweenness exact(G, true);
+        exact.run();
+
+        ApproxBetweenness approx(G, 0.05, 0.1);
+        approx.run();
+        EXPECT_GT(approx.samplesPerSecond(), 0);
+        G.forNodes([&](node u) { EXPECT_NEAR(exact.score(u), approx.score(u), 0.05); });
+
+        EstimateBetweenness estimate(G, 20, false, true);
+        estimate.run();
+        EXPECT_GT(estimate.samplesPerSecond(), 0);
+
+        // Kadabra needs a diameter estimate, which is only available for undirected graphs.
+        if (!directed) {
+            KadabraBetweenness kadabra(G, 0.05, 0.1);
+            kadabra.run();
+            EXPECT_GE(kadabra.getSamplesPerSecond(), 0);
+        }
+    }
+}
+
 TEST_P(CentralityGTest, testDynTopHarmonicCloseness) {
     auto G1 = DorogovtsevMendesGenerator(500).generate();
     Graph G(G1, false, isDirected());
@@ -5,6 +5,7 @@
  *      Author: cls, Fabian Brandt-Tumescheit
  */
 
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 
@@ -75,6 +76,48 @@ TEST_P(TopClosenessGTest, testTopCloseness) {
     }
 }
 
+TEST_P(TopClosenessGTest, testTopClosenessBatched) {
+    constexpr count size = 400;
+
+    for (bool isDirected : {false, true}) {
+        Aux::Random::setSeed(42, false);
+        const auto G = ErdosRenyiGenerator(size, 0.01, isDirected).generate();
+        Closeness cc(G, true, ClosenessVariant::GENERALIZED);
+        cc.run();
+        const auto ranking = cc.ranking();
+
+        // Compared to the exact scores rather than to the unbatched algorithm: with a cut BFS,
+        // the latter may report nodes whose lower bound equals the k-th score as ties.
+        for (count k : {1, 10, 100}) {
+            TopCloseness batched(G, k, useFirstHeu(), useSecondHeu());
+            batched.setBatchedBFS(true);
+            batched.run();
+
+            const auto scores = batched.topkScoresList();
+            ASSERT_EQ(scores.size(), k);
+            for (count i = 0; i < k; ++i)
+                EXPECT_DOUBLE_EQ(ranking[i].second, scores[i]);
+        }
+    }
+}
+
+TEST_P(TopClosenessGTest, testTopClosenessBatchedSelfLoop) {
+    // Node 0 only has a self-loop and therefore reaches no other node.
+    Graph G(5);
+    G.addEdge(0, 0);
+    G.addEdge(1, 2);
+    G.addEdge(2, 3);
+    G.addEdge(2, 4);
+
+    TopCloseness batched(G, 5, useFirstHeu(), useSecondHeu());
+    batched.setBatchedBFS(true);
+    batched.run();
+
+    for (double score : batched.topkScoresList())
+        EXPECT_FALSE(std::isnan(score));
+    EXPECT_EQ(batched.topkNodesList().front(), 2);
+}
+
 TEST_P(TopClosenessGTest, testTopClosenessWithNodeList) {
     METISGraphReader reader;
     Graph G = reader.read("input/lesmis.graph");
@@ -138,6 +181,31 @@ TEST_P(TopHarmonicClosenessGTest, testTopHarmonicCloseness) {
     }
 }
 
+TEST_F(TopHarmonicClosenessGTest, testTopHarmonicClosenessBatched) {
+    const count size = 400;
+    const double tol = 1e-6;
+
+    for (bool isDirected : {false, true}) {
+        Aux::Random::setSeed(42, false);
+        const auto G = ErdosRenyiGenerator(size, 0.01, isDirected).generate();
+        HarmonicCloseness cc(G, false);
+        cc.run();
+        const auto ranking = cc.ranking();
+        for (count k : {1, 10, 100}) {
+            TopHarmonicCloseness topcc(G, k);
+            topcc.setBatchedBFS(true);
+            topcc.run();
+
+            EXPECT_EQ(topcc.topkNodesList().size(), k);
+            const auto topkScores = topcc.topkScoresList(true);
+            for (count i = 0; i < topkScores.size(); ++i)
+                EXPECT_NEAR(ranking[i].second, topkScores[i], tol);
+            for (count i = k; i < topkScores.size(); ++i)
+                EXPECT_NEAR(topkScores[i], topkScores[k - 1], tol);
+        }
+    }
+}
+
 TEST_P(TopHarmonicClosenessGTest, testTopHarmonicClosenessWithNodeList) {
     METISGraphReader reader;
     Graph G = reader.read("input/lesmis.graph");
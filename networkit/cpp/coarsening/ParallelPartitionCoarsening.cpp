@@ -5,9 +5,12 @@
  *      Author: cls
  */
 
+#include <algorithm>
 #include <numeric>
+#include <utility>
 #include <omp.h>
 
+#include <networkit/auxiliary/HashAccumulator.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/coarsening/ParallelPartitionCoarsening.hpp>
@@ -24,43 +27,107 @@ void ParallelPartitionCoarsening::run() {
     nodeToSuperNode.compact((zeta.upperBound() <= G->upperNodeIdBound()));
     index numParts = nodeToSuperNode.upperBound();
 
-    // sort fine vertices by coarse vertices
+    // sort fine vertices by coarse vertices with a counting sort
     std::vector<index> partBegin(numParts + 2, 0);
     std::vector<node> nodesSortedByPart(G->numberOfNodes());
-    G->forNodes([&](const node u) { partBegin[nodeToSuperNode[u] + 2]++; });
-    std::partial_sum(partBegin.begin(), partBegin.end(), partBegin.begin());
-    G->forNodes([&](const node u) { nodesSortedByPart[partBegin[nodeToSuperNode[u] + 1]++] = u; });
+    const count z = G->upperNodeIdBound();
+    const count maxThreads = static_cast<count>(omp_get_max_threads());
+    const bool fewParts = numParts * maxThreads <= z;
+#ifndef NETWORKIT_OMP2
+    const bool sequentialSort = !parallel;
+#else
+    // without atomic capture, only the per-thread counting sort of few parts runs in parallel
+    const bool sequentialSort = !parallel || !fewParts;
+#endif // NETWORKIT_OMP2
+    if (sequentialSort) {
+        G->forNodes([&](const node u) { partBegin[nodeToSuperNode[u] + 2]++; });
+        std::partial_sum(partBegin.begin(), partBegin.end(), partBegin.begin());
+        G->forNodes(
+            [&](const node u) { nodesSortedByPart[partBegin[nodeToSuperNode[u] + 1]++] = u; });
+    } else if (fewParts) {
+        // With few parts, shared atomic counters would be contended. Instead, every thread
+        // counts the nodes of a static block of ids, and the prefix sum over (part, thread)
+        // yields the position of each thread's nodes within a part; the sort is stable.
+        std::vector<index> threadOffset(maxThreads * numParts, 0);
+#pragma omp parallel
+        {
+            const count threads = static_cast<count>(omp_get_num_threads());
+            index *offset = threadOffset.data() + omp_get_thread_num() * numParts;
+
+#pragma omp for schedule(static)
+            for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+                if (G->hasNode(u))
+                    ++offset[nodeToSuperNode[u]];
+
+#pragma omp for schedule(static)
+            for (omp_index part = 0; part < static_cast<omp_index>(numParts); ++part) {
+                index size = 0;
+                for (index t = 0; t < threads; ++t)
+                    size += std::exchange(threadOffset[t * numParts + part], size);
+                partBegin[part + 1] = size;
+            }
+
+#pragma omp single
+            std::partial_sum(partBegin.begin(), partBegin.end(), partBegin.begin());
+
+#pragma omp for schedule(static)
+            for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+                if (G->hasNode(u)) {
+                    const index part = nodeToSuperNode[u];
+                    nodesSortedByPart[partBegin[part] + offset[part]++] = u;
+                }
+        }
+    } else {
+#ifndef NETWORKIT_OMP2
+        // With many parts, there is little contention on the counters. In this case, the order
+        // of the fine vertices of a coarse vertex depends on the scheduling.
+        G->parallelForNodes([&](const node u) {
+#pragma omp atomic
+            partBegin[nodeToSuperNode[u] + 2]++;
+        });
+        std::partial_sum(partBegin.begin(), partBegin.end(), partBegin.begin());
+        G->parallelForNodes([&](const node u) {
+            index pos;
+#pragma omp atomic capture
+            pos = partBegin[nodeToSuperNode[u] + 1]++;
+            nodesSortedByPart[pos] = u;
+        });
+#endif // NETWORKIT_OMP2
+    }
 
     Gcoarsened = Graph(numParts, true, false);
 
+    // Sums up the weights of the edges from the fine vertices of su to each coarse vertex in a
+    // hash table whose size depends on the degrees of the fine vertices, not on numParts, and
+    // writes the edges directly into the adjacency of su.
     auto aggregateEdgeWeights = [&](node su, count &numEdges, count &numSelfLoops,
-                                    std::vector<edgeweight> &incidentPartWeights,
-                                    std::vector<node> &incidentParts) {
+                                    HashAccumulator<edgeweight> &incidentParts) {
+        count fineDegree = 0;
+        for (index i = partBegin[su]; i < partBegin[su + 1]; ++i)
+            fineDegree += G->degree(nodesSortedByPart[i]);
+        incidentParts.reset(std::min(fineDegree, numParts));
+
         for (index i = partBegin[su]; i < partBegin[su + 1]; ++i) {
             node u = nodesSortedByPart[i];
             G->forNeighborsOf(u, [&](node v, edgeweight ew) {
                 const node sv = nodeToSuperNode[v];
-                if (sv != su || u >= v) {
-                    if (incidentPartWeights[sv] == 0.0) {
-                        incidentParts.push_back(sv);
-                    }
-                    incidentPartWeights[sv] += ew;
-                }
+                if (sv != su || u >= v)
+                    incidentParts.add(sv, ew);
             });
         }
 
+        bool hasSelfLoop = false;
+        Gcoarsened.preallocateUndirected(su, incidentParts.size());
+        incidentParts.forEntries([&](node sv, edgeweight ew) {
+            hasSelfLoop |= sv == su;
+            Gcoarsened.addPartialEdge(unsafe, su, sv, ew);
+        });
+
         numEdges += incidentParts.size();
-        if (incidentPartWeights[su] != 0.0) {
+        if (hasSelfLoop) {
             numSelfLoops += 1;
             numEdges -= 1;
         }
-
-        Gcoarsened.preallocateUndirected(su, incidentParts.size());
-        for (node sv : incidentParts) {
-            Gcoarsened.addPartialEdge(unsafe, su, sv, incidentPartWeights[sv]);
-            incidentPartWeights[sv] = 0.0;
-        }
-        incidentParts.clear();
     };
 
     count numEdges = 0;
@@ -68,33 +135,19 @@ void ParallelPartitionCoarsening::run() {
     if (!parallel) {
         // The code has duplication because even the overhead of opening the parallel section was
         // too much if used on lots of very small graphs, as in Ego-Splitting for example
-        std::vector<edgeweight> incidentPartWeights(numParts, 0.0);
-        std::vector<node> incidentParts;
-        incidentParts.reserve(numParts);
+        HashAccumulator<edgeweight> incidentParts;
         for (node su = 0; su < numParts; ++su) {
-            aggregateEdgeWeights(su, numEdges, numSelfLoops, incidentPartWeights, incidentParts);
+            aggregateEdgeWeights(su, numEdges, numSelfLoops, incidentParts);
         }
     } else {
-#pragma omp parallel
+#pragma omp parallel reduction(+ : numEdges, numSelfLoops)
         {
-            std::vector<edgeweight> incidentPartWeights(numParts, 0.0);
-            std::vector<node> incidentParts;
-            incidentParts.reserve(numParts);
+            HashAccumulator<edgeweight> incidentParts;
 
-            count localEdges = 0;
-            count localSelfLoops = 0;
-
-#pragma omp for schedule(guided) nowait
+#pragma omp for schedule(guided)
             for (omp_index su = 0; su < static_cast<omp_index>(numParts); ++su) {
-                aggregateEdgeWeights(su, localEdges, localSelfLoops, incidentPartWeights,
-                                     incidentParts);
+                aggregateEdgeWeights(su, numEdges, numSelfLoops, incidentParts);
             }
-
-#pragma omp atomic
-            numEdges += localEdges;
-
-#pragma omp atomic
-            numSelfLoops += localSelfLoops;
         }
     }
 
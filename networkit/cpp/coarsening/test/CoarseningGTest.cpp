@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <map>
+
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/coarsening/ClusteringProjector.hpp>
 #include <networkit/coarsening/GraphCoarsening.hpp>
 #include <networkit/coarsening/MatchingCoarsening.hpp>
@@ -290,6 +294,71 @@ TEST_F(CoarseningGTest, testParallelPartitionCoarseningOnRealGraphWithLoops) {
     });
 }
 
+TEST_F(CoarseningGTest, testParallelPartitionCoarseningFewClustersDeletedNodes) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(2000, 0.01).generate();
+    for (node u = 0; u < G.upperNodeIdBound(); u += 7)
+        G.removeNode(u);
+
+    ClusteringGenerator clusteringGen;
+    const Partition random = clusteringGen.makeRandomClustering(G, 3);
+
+    ParallelPartitionCoarsening parCoarsening(G, random, true);
+    parCoarsening.run();
+    ParallelPartitionCoarsening seqCoarsening(G, random, false);
+    seqCoarsening.run();
+    const Graph &Gpar = parCoarsening.getCoarseGraph(), &Gseq = seqCoarsening.getCoarseGraph();
+
+    EXPECT_EQ(Gpar.numberOfNodes(), random.numberOfSubsets());
+    EXPECT_EQ(Gpar.numberOfEdges(), Gseq.numberOfEdges());
+    EXPECT_EQ(Gpar.totalEdgeWeight(), G.totalEdgeWeight());
+    EXPECT_EQ(parCoarsening.getFineToCoarseNodeMapping(),
+              seqCoarsening.getFineToCoarseNodeMapping());
+    Gseq.forNodes([&](node su) {
+        EXPECT_EQ(Gpar.weightedDegree(su), Gseq.weightedDegree(su));
+        Gseq.forNeighborsOf(su, [&](node sv, edgeweight w) { EXPECT_EQ(Gpar.weight(su, sv), w); });
+    });
+}
+
+TEST_F(CoarseningGTest, testPartitionCoarseningEdgeWeightsManyClusters) {
+    Aux::Random::setSeed(42, false);
+    Graph G(ErdosRenyiGenerator(1000, 0.02).generate(), true, false);
+    G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 10)); });
+    G.addEdge(0, 0, 3);
+
+    ClusteringGenerator clusteringGen;
+    Partition random = clusteringGen.makeRandomClustering(G, 250);
+
+    for (bool parallel : {false, true}) {
+        ParallelPartitionCoarsening coarsening(G, random, parallel);
+        coarsening.run();
+        const Graph &coarseGraph = coarsening.getCoarseGraph();
+        const std::vector<node> &fineToCoarse = coarsening.getFineToCoarseNodeMapping();
+
+        std::map<std::pair<node, node>, edgeweight> expected;
+        G.forEdges([&](node u, node v, edgeweight w) {
+            const node su = fineToCoarse[u], sv = fineToCoarse[v];
+            expected[std::minmax(su, sv)] += w;
+        });
+
+        EXPECT_EQ(coarseGraph.numberOfEdges(), expected.size());
+        EXPECT_EQ(coarseGraph.totalEdgeWeight(), G.totalEdgeWeight());
+        count selfLoops = 0;
+        for (const auto &edge : expected) {
+            const node su = edge.first.first, sv = edge.first.second;
+            EXPECT_EQ(coarseGraph.weight(su, sv), edge.second);
+            EXPECT_EQ(coarseGraph.weight(sv, su), edge.second);
+            selfLoops += su == sv;
+        }
+        EXPECT_EQ(coarseGraph.numberOfSelfLoops(), selfLoops);
+        coarseGraph.forNodes([&](node su) {
+            count degree = 0;
+            coarseGraph.forNeighborsOf(su, [&](node) { ++degree; });
+            EXPECT_EQ(coarseGraph.degree(su), degree);
+        });
+    }
+}
+
 TEST_F(CoarseningGTest, testMatchingContractor) {
     METISGraphReader reader;
     Graph G = reader.read("input/celegans_metabolic.graph");
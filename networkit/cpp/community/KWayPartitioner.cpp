@@ -0,0 +1,316 @@
+/*
+ * KWayPartitioner.cpp
+ *
+ * Multilevel balanced k-way graph partitioning.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include <networkit/coarsening/ParallelPartitionCoarsening.hpp>
+#include <networkit/community/KWayPartitioner.hpp>
+#include <networkit/graph/GraphTools.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// The graph is coarsened until it has at most this many nodes per block.
+constexpr count coarsestNodesPerBlock = 20;
+// Label propagation does not grow a cluster beyond this fraction of a block during coarsening.
+constexpr double maxNodeWeightFraction = 0.2;
+// Coarsening stops once a level removes less than this fraction of the nodes.
+constexpr double minShrinkage = 0.05;
+// Number of label propagation rounds that compute the clusters contracted on each level.
+constexpr count clusteringIterations = 5;
+// Number of initial partitions of the coarsest graph, from different BFS start nodes.
+constexpr count initialPartitioningTries = 16;
+
+// One round of parallel size-constrained label propagation: every node moves to the adjacent
+// label it is connected to most strongly, if the label stays within maxLabelWeight and the
+// connection is stronger than to its own label. Nodes whose label is overloaded may also move
+// to a weaker connected label. Returns the number of moved nodes.
+count labelPropagationRound(const Graph &graph, const std::vector<double> &nodeWeights,
+                            std::vector<index> &labels, std::vector<double> &labelWeights,
+                            double maxLabelWeight) {
+    count moved = 0;
+
+    // Without atomic read, write and capture (NETWORKIT_OMP2), the nodes are visited sequentially.
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel reduction(+ : moved)
+#endif // NETWORKIT_OMP2
+    {
+        // (label, weight) of the edges of the current node, aggregated by sorting
+        std::vector<std::pair<index, edgeweight>> connections;
+
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(graph.upperNodeIdBound()); ++i) {
+            const node u = static_cast<node>(i);
+            if (!graph.hasNode(u))
+                continue;
+
+            connections.clear();
+            graph.forNeighborsOf(u, [&](node v, edgeweight w) {
+                if (v == u)
+                    return;
+                index labelOfV;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic read
+#endif // NETWORKIT_OMP2
+                labelOfV = labels[v];
+                connections.emplace_back(labelOfV, w);
+            });
+            std::sort(connections.begin(), connections.end());
+
+            const index own = labels[u];
+            const double weight = nodeWeights[u];
+            double ownWeight;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic read
+#endif // NETWORKIT_OMP2
+            ownWeight = labelWeights[own];
+
+            edgeweight ownConnection = 0;
+            for (const auto &connection : connections)
+                if (connection.first == own)
+                    ownConnection += connection.second;
+
+            index best = own;
+            edgeweight bestConnection = ownWeight <= maxLabelWeight
+                                            ? ownConnection
+                                            : -std::numeric_limits<edgeweight>::max();
+            for (index j = 0; j < connections.size();) {
+                const index label = connections[j].first;
+                edgeweight labelConnection = 0;
+                for (; j < connections.size() && connections[j].first == label; ++j)
+                    labelConnection += connections[j].second;
+                if (label == own || labelConnection <= bestConnection)
+                    continue;
+
+                double labelWeight;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic read
+#endif // NETWORKIT_OMP2
+                labelWeight = labelWeights[label];
+                if (labelWeight + weight <= maxLabelWeight) {
+                    best = label;
+                    bestConnection = labelConnection;
+                }
+            }
+
+            if (best == own)
+                continue;
+
+            // reserve the space of u in the target label, other threads may have used it
+            double newWeight;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic capture
+#endif // NETWORKIT_OMP2
+            {
+                labelWeights[best] += weight;
+                newWeight = labelWeights[best];
+            }
+            if (newWeight > maxLabelWeight) {
+#pragma omp atomic
+                labelWeights[best] -= weight;
+                continue;
+            }
+
+#pragma omp atomic
+            labelWeights[own] -= weight;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic write
+#endif // NETWORKIT_OMP2
+            labels[u] = best;
+            ++moved;
+        }
+    }
+
+    return moved;
+}
+
+} // namespace
+
+KWayPartitioner::KWayPartitioner(const Graph &G, count k, double epsilon,
+                                 count maxRefinementIterations)
+    : CommunityDetectionAlgorithm(G), k(k), epsilon(epsilon),
+      maxRefinementIterations(maxRefinementIterations) {
+    if (G.isDirected())
+        throw std::runtime_error("KWayPartitioner only supports undirected graphs.");
+    if (k == 0)
+        throw std::runtime_error("The number of blocks must be positive.");
+    if (epsilon < 0)
+        throw std::runtime_error("The imbalance must not be negative.");
+}
+
+void KWayPartitioner::run() {
+    const count n = G->numberOfNodes();
+    const double maxBlockWeight =
+        (1 + epsilon) * std::ceil(static_cast<double>(n) / static_cast<double>(k));
+    const double maxNodeWeight = std::max(1.0, maxNodeWeightFraction * maxBlockWeight);
+
+    // coarse graphs, the mapping from each level to the next coarser one, and node weights
+    std::vector<Graph> coarseGraphs;
+    std::vector<std::vector<node>> fineToCoarse;
+    std::vector<std::vector<double>> nodeWeights;
+    nodeWeights.emplace_back(G->upperNodeIdBound(), 1.0);
+
+    const auto graphOfLevel = [&](index level) -> const Graph & {
+        return level == 0 ? *G : coarseGraphs[level - 1];
+    };
+
+    while (graphOfLevel(coarseGraphs.size()).numberOfNodes() > k * coarsestNodesPerBlock) {
+        const Graph &fine = graphOfLevel(coarseGraphs.size());
+        const std::vector<double> &weights = nodeWeights.back();
+
+        // contract clusters found by size-constrained label propagation
+        std::vector<index> labels(fine.upperNodeIdBound());
+        std::iota(labels.begin(), labels.end(), 0);
+        std::vector<double> clusterWeights = weights;
+        for (count iteration = 0; iteration < clusteringIterations; ++iteration)
+            if (labelPropagationRound(fine, weights, labels, clusterWeights, maxNodeWeight) == 0)
+                break;
+
+        Partition clusters(labels);
+        clusters.setUpperBound(fine.upperNodeIdBound());
+        ParallelPartitionCoarsening coarsening(fine, clusters);
+        coarsening.run();
+        Graph coarse = std::move(coarsening.getCoarseGraph());
+        if (static_cast<double>(coarse.numberOfNodes())
+            > (1 - minShrinkage) * static_cast<double>(fine.numberOfNodes()))
+            break;
+
+        std::vector<node> mapping = std::move(coarsening.getFineToCoarseNodeMapping());
+        std::vector<double> coarseWeights(coarse.upperNodeIdBound(), 0.0);
+        fine.forNodes([&](node u) { coarseWeights[mapping[u]] += weights[u]; });
+
+        coarseGraphs.push_back(std::move(coarse));
+        fineToCoarse.push_back(std::move(mapping));
+        nodeWeights.push_back(std::move(coarseWeights));
+    }
+
+    index level = coarseGraphs.size();
+    const Graph &coarsest = graphOfLevel(level);
+    std::vector<index> blocks;
+    edgeweight bestCut = std::numeric_limits<edgeweight>::max();
+    for (count i = 0; i < initialPartitioningTries && coarsest.numberOfNodes() > 0; ++i) {
+        std::vector<index> candidate =
+            initialPartition(coarsest, nodeWeights[level], GraphTools::randomNode(coarsest));
+        refine(coarsest, nodeWeights[level], candidate, maxBlockWeight);
+        const edgeweight cut = coarsest.parallelSumForEdges([&](node u, node v, edgeweight w) {
+            return candidate[u] != candidate[v] ? w : 0.0;
+        });
+        if (cut < bestCut) {
+            bestCut = cut;
+            blocks = std::move(candidate);
+        }
+    }
+
+    while (level > 0) {
+        --level;
+        const Graph &fine = graphOfLevel(level);
+        const std::vector<node> &mapping = fineToCoarse[level];
+        std::vector<index> fineBlocks(fine.upperNodeIdBound(), none);
+        fine.parallelForNodes([&](node u) { fineBlocks[u] = blocks[mapping[u]]; });
+        blocks = std::move(fineBlocks);
+
+        // free the coarse level before refining the finer one
+        coarseGraphs.pop_back();
+        nodeWeights.pop_back();
+        refine(fine, nodeWeights[level], blocks, maxBlockWeight);
+    }
+
+    result = Partition(G->upperNodeIdBound());
+    result.setUpperBound(k);
+    G->parallelForNodes([&](node u) { result[u] = blocks[u]; });
+
+    computeMetrics();
+    hasRun = true;
+}
+
+std::vector<index>
+KWayPartitioner::initialPartition(const Graph &coarsest, const std::vector<double> &nodeWeights,
+                                  node start) const {
+    double totalWeight = 0;
+    coarsest.forNodes([&](node u) { totalWeight += nodeWeights[u]; });
+    const double targetWeight = totalWeight / static_cast<double>(k);
+
+    // Cut a BFS order from start into k consecutive pieces of about the same weight, so that
+    // the blocks are mostly connected.
+    std::vector<index> blocks(coarsest.upperNodeIdBound(), none);
+    std::vector<node> queue;
+    queue.reserve(coarsest.numberOfNodes());
+    double cumulativeWeight = 0;
+    const auto assignComponent = [&](node root) {
+        if (blocks[root] != none)
+            return;
+        queue.assign(1, root);
+        blocks[root] = 0;
+        for (index i = 0; i < queue.size(); ++i) {
+            const node u = queue[i];
+            const double center = cumulativeWeight + nodeWeights[u] / 2;
+            blocks[u] = std::min<index>(k - 1, static_cast<index>(center / targetWeight));
+            cumulativeWeight += nodeWeights[u];
+            coarsest.forNeighborsOf(u, [&](node v) {
+                if (blocks[v] == none) {
+                    blocks[v] = 0;
+                    queue.push_back(v);
+                }
+            });
+        }
+    };
+    assignComponent(start);
+    coarsest.forNodes(assignComponent);
+
+    return blocks;
+}
+
+void KWayPartitioner::refine(const Graph &graph, const std::vector<double> &nodeWeights,
+                             std::vector<index> &blocks, double maxBlockWeight) const {
+    std::vector<double> blockWeights(k, 0.0);
+    graph.forNodes([&](node u) { blockWeights[blocks[u]] += nodeWeights[u]; });
+
+    for (count iteration = 0; iteration < maxRefinementIterations; ++iteration)
+        if (labelPropagationRound(graph, nodeWeights, blocks, blockWeights, maxBlockWeight) == 0)
+            break;
+}
+
+void KWayPartitioner::computeMetrics() {
+    edgeCut = G->parallelSumForEdges(
+        [&](node u, node v, edgeweight w) { return result[u] != result[v] ? w : 0.0; });
+
+    count volume = 0;
+#pragma omp parallel reduction(+ : volume)
+    {
+        // the last node that has counted each block as adjacent
+        std::vector<node> counted(k, none);
+
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(G->upperNodeIdBound()); ++i) {
+            const node u = static_cast<node>(i);
+            if (!G->hasNode(u))
+                continue;
+            G->forNeighborsOf(u, [&](node v) {
+                const index block = result[v];
+                if (block != result[u] && counted[block] != u) {
+                    counted[block] = u;
+                    ++volume;
+                }
+            });
+        }
+    }
+    communicationVolume = volume;
+
+    std::vector<count> blockSizes(k, 0);
+    G->forNodes([&](node u) { ++blockSizes[result[u]]; });
+    const double target = std::ceil(static_cast<double>(G->numberOfNodes()) / k);
+    imbalance = G->numberOfNodes() == 0
+                    ? 0.0
+                    : *std::max_element(blockSizes.begin(), blockSizes.end()) / target - 1;
+}
+
+} // namespace NetworKit
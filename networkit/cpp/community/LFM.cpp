@@ -5,7 +5,8 @@
  *      Author: John Gelhausen
  */
 
-#include <iostream>
+#include <vector>
+
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/community/LFM.hpp>
 
@@ -17,26 +18,26 @@ LFM::LFM(const Graph &G, SelectiveCommunityDetector &scd)
 void LFM::run() {
     Aux::SignalHandler handler;
 
-    Cover zeta(G->upperNodeIdBound());
+    CompactCoverBuilder zeta(G->upperNodeIdBound());
+    std::vector<bool> assigned(G->upperNodeIdBound(), false);
     index o = 0;
-    zeta.setUpperBound(o);
 
     G->forNodesInRandomOrder([&](node u) {
         handler.assureRunning();
-        if (!zeta.contains(u)) {
+        if (!assigned[u]) {
             std::set<node> community = scd->expandOneCommunity(u);
             o++;
-            zeta.setUpperBound(o);
 
             handler.assureRunning();
 
             for (node n : community) {
                 zeta.addToSubset(o - 1, n);
+                assigned[n] = true;
             }
         }
     });
 
-    result = std::move(zeta);
+    setResult(zeta.build());
     hasRun = true;
 }
 
@@ -27,11 +27,18 @@ LouvainMapEquation::LouvainMapEquation(const Graph &graph, bool hierarchical, co
       parallelizationType(parallelizationType), hierarchical(hierarchical),
       maxIterations(maxIterations), clusterCut(graph.upperNodeIdBound()),
       clusterVolume(graph.upperNodeIdBound()),
-      locks(parallelizationType == ParallelizationType::RELAX_MAP ? graph.upperNodeIdBound() : 0),
+      locks(parallelizationType == ParallelizationType::RELAX_MAP
+                ? std::min(graph.upperNodeIdBound(), maxNumberOfLocks)
+                : 0),
       nextPartition(
           parallelizationType == ParallelizationType::SYNCHRONOUS ? graph.upperNodeIdBound() : 0),
       ets_neighborClusterWeights(parallel ? Aux::getMaxNumberOfThreads() : 1) {
     result = Partition(graph.upperNodeIdBound());
+    if (parallelizationType == ParallelizationType::SYNCHRONOUS) {
+        const count maxThreads = Aux::getMaxNumberOfThreads();
+        ets_clusterUpdates.resize(maxThreads, std::vector<std::vector<ClusterUpdate>>(maxThreads));
+        ets_totalCutUpdate.resize(maxThreads);
+    }
 }
 
 void LouvainMapEquation::run() {
@@ -146,7 +153,8 @@ count LouvainMapEquation::synchronousLocalMoving(std::vector<node> &nodes, count
 #pragma omp parallel
     {
 
-        int tid = omp_get_thread_num();
+        const index tid = omp_get_thread_num();
+        const count numThreads = omp_get_num_threads();
 
         SparseVector<double> &neighborClusterWeights = ets_neighborClusterWeights[tid];
         std::vector<Move> moves;
@@ -168,12 +176,12 @@ count LouvainMapEquation::synchronousLocalMoving(std::vector<node> &nodes, count
             }
             // implicit barrier at the end of the loop
 
-            // apply the moves and update cut/volume
-            // every thread applies the moves that it calculated
-            aggregateAndApplyCutAndVolumeUpdates(moves);
+            // compute the cut/volume updates of the moves found by this thread
+            collectCutAndVolumeUpdates(moves, tid, numThreads);
 #pragma omp barrier
 
-            // apply moves
+            // every thread updates cut/volume of the clusters it owns and applies its own moves
+            applyCutAndVolumeUpdates(tid, numThreads);
             for (Move &m : moves) {
                 assert(m.targetCluster == nextPartition[m.movedNode]);
                 result[m.movedNode] = m.targetCluster;
@@ -194,19 +202,21 @@ count LouvainMapEquation::synchronousLocalMoving(std::vector<node> &nodes, count
     return numberOfNodesMoved;
 }
 
-void LouvainMapEquation::aggregateAndApplyCutAndVolumeUpdates(std::vector<Move> &moves) {
+void LouvainMapEquation::collectCutAndVolumeUpdates(const std::vector<Move> &moves,
+                                                    index thread, count numThreads) {
+    // clusters are owned by threads in contiguous ranges of IDs
+    const count clustersPerThread = idivCeil(G->upperNodeIdBound(), numThreads);
+    auto &updates = ets_clusterUpdates[thread];
+    const auto addUpdate = [&](index cluster, double cutUpdate, double volumeUpdate) {
+        updates[cluster / clustersPerThread].push_back({cluster, cutUpdate, volumeUpdate});
+    };
+
     double totalCutUpdate = 0.0;
-    for (Move &move : moves) {
+    for (const Move &move : moves) {
         const index originCluster = move.originCluster;
         const index targetCluster = move.targetCluster;
         const node u = move.movedNode;
 
-// apply volume updates
-#pragma omp atomic
-        clusterVolume[originCluster] -= move.volume;
-#pragma omp atomic
-        clusterVolume[targetCluster] += move.volume;
-
         double originClusterCutUpdate = move.cutUpdateToOriginCluster,
                targetClusterCutUpdate = move.cutUpdateToTargetCluster;
 
@@ -235,17 +245,29 @@ void LouvainMapEquation::aggregateAndApplyCutAndVolumeUpdates(std::vector<Move>
             }
         });
 
-// apply cut updates
-#pragma omp atomic
-        clusterCut[originCluster] += originClusterCutUpdate;
-#pragma omp atomic
-        clusterCut[targetCluster] += targetClusterCutUpdate;
+        addUpdate(originCluster, originClusterCutUpdate, -move.volume);
+        addUpdate(targetCluster, targetClusterCutUpdate, move.volume);
 
         totalCutUpdate += originClusterCutUpdate + targetClusterCutUpdate;
     }
 
-#pragma omp atomic
-    totalCut += totalCutUpdate;
+    ets_totalCutUpdate[thread] = totalCutUpdate;
+}
+
+void LouvainMapEquation::applyCutAndVolumeUpdates(index thread, count numThreads) {
+    for (index t = 0; t < numThreads; ++t) {
+        auto &updates = ets_clusterUpdates[t][thread];
+        for (const ClusterUpdate &update : updates) {
+            clusterCut[update.cluster] += update.cut;
+            clusterVolume[update.cluster] += update.volume;
+        }
+        updates.clear();
+    }
+
+    if (thread == 0) {
+        for (index t = 0; t < numThreads; ++t)
+            totalCut += ets_totalCutUpdate[t];
+    }
 }
 
 // for every node. store its neighbors that are in the current chunk, and their old cluster IDs, and
@@ -372,8 +394,11 @@ bool LouvainMapEquation::performMove(node u, double degree, double loopWeight, n
         assert(parallelizationType == ParallelizationType::RELAX_MAP);
 
         // lock currentCluster and targetCluster
-        locks[std::min(currentCluster, targetCluster)].lock();
-        locks[std::max(currentCluster, targetCluster)].lock();
+        const index firstLock = std::min(lockIndex(currentCluster), lockIndex(targetCluster));
+        const index secondLock = std::max(lockIndex(currentCluster), lockIndex(targetCluster));
+        locks[firstLock].lock();
+        if (secondLock != firstLock)
+            locks[secondLock].lock();
 
         // recompute weightToCurrent and weightToTarget
         weightToCurrent = 0;
@@ -416,8 +441,11 @@ bool LouvainMapEquation::performMove(node u, double degree, double loopWeight, n
 
     if (parallel) {
         // unlock clusters again
-        locks[std::max(currentCluster, targetCluster)].unlock();
-        locks[std::min(currentCluster, targetCluster)].unlock();
+        const index firstLock = std::min(lockIndex(currentCluster), lockIndex(targetCluster));
+        const index secondLock = std::max(lockIndex(currentCluster), lockIndex(targetCluster));
+        if (secondLock != firstLock)
+            locks[secondLock].unlock();
+        locks[firstLock].unlock();
     }
 
     return moved;
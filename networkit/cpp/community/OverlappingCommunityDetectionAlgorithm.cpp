@@ -19,7 +19,30 @@ OverlappingCommunityDetectionAlgorithm::OverlappingCommunityDetectionAlgorithm(c
 
 const Cover &OverlappingCommunityDetectionAlgorithm::getCover() const {
     assureFinished();
+    if (compactIsResult)
+        std::call_once(*conversion, [&] { result = compactResult.toCover(); });
     return result;
 }
 
+const CompactCover &OverlappingCommunityDetectionAlgorithm::getCompactCover() const {
+    assureFinished();
+    if (!compactIsResult)
+        std::call_once(*conversion, [&] { compactResult = CompactCover(result); });
+    return compactResult;
+}
+
+void OverlappingCommunityDetectionAlgorithm::setResult(Cover cover) {
+    result = std::move(cover);
+    compactResult = CompactCover();
+    compactIsResult = false;
+    conversion = std::make_unique<std::once_flag>();
+}
+
+void OverlappingCommunityDetectionAlgorithm::setResult(CompactCover cover) {
+    compactResult = std::move(cover);
+    result = Cover(0);
+    compactIsResult = true;
+    conversion = std::make_unique<std::once_flag>();
+}
+
 } /* namespace NetworKit */
@@ -9,6 +9,7 @@
 #include <sstream>
 #include <utility>
 
+#include <networkit/auxiliary/HashAccumulator.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/auxiliary/Timer.hpp>
@@ -64,6 +65,8 @@ void PLM::run() {
     std::vector<std::vector<edgeweight>> turboAffinity;
     // stores the list of neighboring communities, one vector per thread
     std::vector<std::vector<index>> neigh_comm;
+    // stores the affinity for each neighboring community if turbo is disabled, one per thread
+    std::vector<HashAccumulator<edgeweight>> affinities(omp_get_max_threads());
 
     if (turbo) {
         // initialize arrays for all threads only when actually needed
@@ -86,7 +89,7 @@ void PLM::run() {
         index tid = omp_get_thread_num();
 
         // collect edge weight to neighbor clusters
-        std::map<index, edgeweight> affinity;
+        HashAccumulator<edgeweight> &affinity = affinities[tid];
 
         if (turbo) {
             neigh_comm[tid].clear();
@@ -106,10 +109,10 @@ void PLM::run() {
                 }
             });
         } else {
+            affinity.reset(G->degree(u));
             G->forNeighborsOf(u, [&](node v, edgeweight weight) {
                 if (u != v) {
-                    index C = zeta[v];
-                    affinity[C] += weight;
+                    affinity.add(zeta[v], weight);
                 }
             });
         }
@@ -161,19 +164,19 @@ void PLM::run() {
                 }
             }
         } else {
-            edgeweight affinityC = affinity[C];
+            edgeweight affinityC = affinity.get(C);
 
-            for (auto it : affinity) {
-                index D = it.first;
+            affinity.forEntries([&](index D, edgeweight affinityD) {
                 // consider only nodes in other clusters (and implicitly only nodes other than u)
                 if (D != C) {
-                    double delta = modGain(u, C, D, affinityC, it.second);
-                    if (delta > deltaBest) {
+                    double delta = modGain(u, C, D, affinityC, affinityD);
+                    // among equal gains, prefer the community with the smallest id
+                    if (delta > deltaBest || (delta == deltaBest && best != none && D < best)) {
                         deltaBest = delta;
                         best = D;
                     }
                 }
-            }
+            });
         }
 
         if (deltaBest > 0) {                   // if modularity improvement possible
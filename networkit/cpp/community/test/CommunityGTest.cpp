@@ -25,6 +25,7 @@
 #include <networkit/community/IsolatedInterpartitionConductance.hpp>
 #include <networkit/community/IsolatedInterpartitionExpansion.hpp>
 #include <networkit/community/JaccardMeasure.hpp>
+#include <networkit/community/KWayPartitioner.hpp>
 #include <networkit/community/LFM.hpp>
 #include <networkit/community/LPDegreeOrdered.hpp>
 #include <networkit/community/Modularity.hpp>
@@ -303,6 +304,46 @@ TEST_F(CommunityGTest, testPLM) {
     EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta2));
 }
 
+TEST_F(CommunityGTest, testPLMWithoutTurbo) {
+    METISGraphReader reader;
+    Modularity modularity;
+    Graph G = reader.read("input/PGPgiantcompo.graph");
+
+    for (const std::string par : {"none", "balanced"}) {
+        for (bool turbo : {false, true}) {
+            PLM plm(G, true, 1.0, par, 32, turbo);
+            plm.run();
+            Partition zeta = plm.getPartition();
+
+            EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+            EXPECT_GT(modularity.getQuality(zeta, G), 0.85);
+        }
+    }
+}
+
+TEST_F(CommunityGTest, testKWayPartitioner) {
+    EXPECT_THROW(KWayPartitioner(Graph(10, false, true), 2), std::runtime_error);
+
+    Graph G = METISGraphReader{}.read("input/PGPgiantcompo.graph");
+    const double epsilon = 0.03;
+
+    for (count k : {2, 8, 32}) {
+        KWayPartitioner partitioner(G, k, epsilon);
+        partitioner.run();
+        const Partition &zeta = partitioner.getPartition();
+
+        EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+        EXPECT_LE(zeta.numberOfSubsets(), k);
+        EXPECT_LE(partitioner.getImbalance(), epsilon + 1e-9);
+
+        // the graph has a clear community structure, so the cut must be small
+        EXPECT_DOUBLE_EQ(partitioner.getEdgeCut(), EdgeCut{}.getQuality(zeta, G));
+        EXPECT_LT(partitioner.getEdgeCut(), 0.2 * G.numberOfEdges());
+        EXPECT_LE(partitioner.getCommunicationVolume(), 2 * partitioner.getEdgeCut());
+        EXPECT_GT(partitioner.getCommunicationVolume(), 0u);
+    }
+}
+
 TEST_F(CommunityGTest, testParallelLeiden) {
     METISGraphReader reader;
     Modularity modularity;
@@ -985,7 +1026,46 @@ TEST_F(CommunityGTest, testLFM) {
         EXPECT_TRUE(lfm_cover.contains(u));
     }
 
+    const CompactCover &compact = lfm.getCompactCover();
+    EXPECT_EQ(compact.upperBound(), lfm_cover.upperBound());
+    for (node u = 0; u < 1000; ++u) {
+        EXPECT_EQ(compact.subsetsOf(u),
+                  std::vector<index>(lfm_cover[u].begin(), lfm_cover[u].end()));
+    }
+
     Aux::setNumberOfThreads(numThreads);
 }
 
+namespace {
+// Puts all nodes into the subset given by the number of previous runs.
+class RunCountingCoverAlgorithm final : public OverlappingCommunityDetectionAlgorithm {
+public:
+    RunCountingCoverAlgorithm(const Graph &G) : OverlappingCommunityDetectionAlgorithm(G) {}
+
+    void run() override {
+        Cover C(G->upperNodeIdBound());
+        C.setUpperBound(runs + 1);
+        G->forNodes([&](node u) { C.addToSubset(runs, u); });
+        setResult(std::move(C));
+        ++runs;
+        hasRun = true;
+    }
+
+private:
+    index runs = 0;
+};
+} // namespace
+
+TEST_F(CommunityGTest, testOverlappingCommunityDetectionRerun) {
+    Graph G(5);
+    RunCountingCoverAlgorithm algo(G);
+    algo.run();
+    EXPECT_EQ(algo.getCompactCover().subsetsOf(0), std::vector<index>{0});
+
+    // the compact cover of the first run must not be reused
+    algo.run();
+    EXPECT_EQ(algo.getCompactCover().subsetsOf(0), std::vector<index>{1});
+    EXPECT_EQ(algo.getCover()[0], std::set<index>{1});
+}
+
 } /* namespace NetworKit */
@@ -46,6 +46,23 @@ TEST_F(MapEquationGTest, testLocalMoveSmall) {
     EXPECT_EQ(partition.getSubsets(), groundTruth.getSubsets());
 }
 
+TEST_F(MapEquationGTest, testParallelizationStrategies) {
+    constexpr count cliqueSize = 20, numberOfCliques = 8;
+    Graph G(cliqueSize * numberOfCliques);
+    Partition groundTruth(G.numberOfNodes());
+    for (index i = 0; i < numberOfCliques; ++i) {
+        addClique(G, groundTruth, i * cliqueSize, (i + 1) * cliqueSize - 1);
+        // connect consecutive cliques by a single edge
+        G.addEdge(i * cliqueSize, ((i + 1) % numberOfCliques) * cliqueSize + 1);
+    }
+
+    for (const std::string strategy : {"none", "relaxmap", "synchronous"}) {
+        LouvainMapEquation algo(G, false, 32, strategy);
+        algo.run();
+        EXPECT_EQ(algo.getPartition().getSubsets(), groundTruth.getSubsets()) << strategy;
+    }
+}
+
 TEST_F(MapEquationGTest, testLocalMove) {
     Aux::Random::setSeed(2342556, false);
 
@@ -2,13 +2,18 @@
 #define NETWORKIT_DYN_COMPONENTS_CONNECTED_COMPONENTS_IMPL_HPP_
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <numeric>
 #include <queue>
 #include <stdexcept>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
+#include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/base/Algorithm.hpp>
 #include <networkit/base/DynAlgorithm.hpp>
 #include <networkit/dynamics/GraphEvent.hpp>
@@ -47,7 +52,10 @@ public:
 
     /**
      * Updates the (weakly) connected components after a batch of edge insertions or
-     * deletions.
+     * deletions. Deletions of spanning forest edges are handled by rebuilding the spanning trees
+     * of the affected components: small components are rebuilt in parallel by one BFS each,
+     * large ones by a level-synchronous parallel BFS. Insertions are merged with a concurrent
+     * union-find on the component ids; all nodes are relabeled at most once per batch.
      *
      * @param[in] batch	A vector that contains a batch of edge insertions or
      *					deletions.
@@ -58,13 +66,21 @@ private:
     const Graph *G;
     Partition *componentPtr;
 
-    std::vector<bool> isTree;
+    // Not std::vector<bool>: updateBatch marks tree edges concurrently.
+    std::vector<uint8_t> isTree;
     std::unordered_map<Edge, edgeid> edgesMap;
     std::vector<count> tmpDistances;
 
+    // Affected components with at least this many nodes are rebuilt by a parallel BFS.
+    static constexpr count parallelRebuildSize = 1 << 14;
+    // Smaller BFS frontiers of the parallel rebuild are expanded sequentially.
+    static constexpr count parallelFrontierSize = 1 << 10;
+
     void addEdge(node u, node v);
     void removeEdge(node u, node v);
     void updateTree(node u, node v);
+    void rebuildForest(const std::vector<uint8_t> &affected);
+    void mergeComponents(const std::vector<Edge> &insertions);
     void indexEdges();
     void init();
 };
@@ -343,8 +359,258 @@ void DynConnectedComponentsImpl<WeaklyCC>::update(GraphEvent event) {
 template <bool WeaklyCC>
 void DynConnectedComponentsImpl<WeaklyCC>::updateBatch(const std::vector<GraphEvent> &batch) {
     assureFinished();
-    for (auto event : batch)
-        update(event);
+    auto &component = *componentPtr;
+
+    std::vector<Edge> insertions;
+    std::vector<uint8_t> affected; // components that lost a spanning forest edge
+    bool anyAffected = false;
+
+    for (const auto &event : batch) {
+        if (event.type == GraphEvent::EDGE_ADDITION) {
+            const Edge edge(event.u, event.v, true);
+            if (edgesMap.emplace(edge, static_cast<edgeid>(edgesMap.size())).second)
+                isTree.push_back(false);
+            insertions.push_back(edge);
+        } else if (event.type == GraphEvent::EDGE_REMOVAL) {
+            const auto eid = edgesMap.at(Edge(event.u, event.v, true));
+            if (!isTree[eid])
+                continue;
+            isTree[eid] = false;
+            if (!anyAffected) {
+                affected.assign(component.upperBound(), false);
+                anyAffected = true;
+            }
+            affected[component[event.u]] = true;
+        } else {
+            throw std::runtime_error("This graph event type is not supported");
+        }
+    }
+
+    if (anyAffected)
+        rebuildForest(affected);
+    if (anyAffected || !insertions.empty())
+        mergeComponents(insertions);
+}
+
+template <bool WeaklyCC>
+void DynConnectedComponentsImpl<WeaklyCC>::rebuildForest(const std::vector<uint8_t> &affected) {
+    auto &component = *componentPtr;
+    const std::vector<index> oldComponent = component.getVector();
+    const auto isAffected = [&](node u) { return affected[oldComponent[u]]; };
+
+    // Drop the spanning trees of the affected components and collect their nodes. Each edge is
+    // cleared by its smaller endpoint; edges leaving an affected component were inserted by this
+    // batch and are no tree edges yet.
+    std::vector<node> bucketNodes;
+#pragma omp parallel
+    {
+        std::vector<node> localNodes;
+#pragma omp for schedule(guided) nowait
+        for (omp_index i = 0; i < static_cast<omp_index>(G->upperNodeIdBound()); ++i) {
+            const node u = static_cast<node>(i);
+            if (!G->hasNode(u) || !isAffected(u))
+                continue;
+            auto clearEdge = [&](node x) -> void {
+                if (u <= x)
+                    isTree[edgesMap.at(Edge(u, x, true))] = false;
+            };
+            G->forNeighborsOf(u, clearEdge);
+            if (WeaklyCC)
+                G->forInNeighborsOf(u, clearEdge);
+            component[u] = none;
+            localNodes.push_back(u);
+        }
+#pragma omp critical
+        bucketNodes.insert(bucketNodes.end(), localNodes.begin(), localNodes.end());
+    }
+
+    // Bucket the nodes by their old component, in ascending order within each bucket.
+    Aux::Parallel::sort(bucketNodes.begin(), bucketNodes.end(), [&](node a, node b) {
+        return std::tie(oldComponent[a], a) < std::tie(oldComponent[b], b);
+    });
+    std::vector<index> bucketBegin;
+    for (index i = 0; i < bucketNodes.size(); ++i)
+        if (i == 0 || oldComponent[bucketNodes[i]] != oldComponent[bucketNodes[i - 1]])
+            bucketBegin.push_back(i);
+    bucketBegin.push_back(bucketNodes.size());
+    const count numBuckets = bucketBegin.size() - 1;
+
+    // The first new component of each affected component keeps its id, further ones get new ids.
+    std::atomic<index> nextComponent{component.upperBound()};
+    const auto bucketSize = [&](index b) { return bucketBegin[b + 1] - bucketBegin[b]; };
+
+    // Edges to other components were inserted by this batch and are handled by
+    // mergeComponents(), so only the neighbors in the same old component are visited.
+    const auto forNeighborsInBucket = [&](node u, auto handle) {
+        const index c = oldComponent[u];
+        auto visitNeighbor = [&](node neighbor) -> void {
+            if (oldComponent[neighbor] == c)
+                handle(neighbor);
+        };
+        G->forNeighborsOf(u, visitNeighbor);
+        if (WeaklyCC)
+            G->forInNeighborsOf(u, visitNeighbor);
+    };
+
+    // Small components are rebuilt by a sequential BFS each, in parallel.
+#pragma omp parallel
+    {
+        std::queue<node> queue;
+
+#pragma omp for schedule(dynamic)
+        for (omp_index b = 0; b < static_cast<omp_index>(numBuckets); ++b) {
+            if (bucketSize(b) >= parallelRebuildSize)
+                continue;
+            bool first = true;
+            for (index i = bucketBegin[b]; i < bucketBegin[b + 1]; ++i) {
+                const node s = bucketNodes[i];
+                if (component[s] != none)
+                    continue;
+
+                const index compIdx = first ? oldComponent[s] : nextComponent++;
+                first = false;
+                component[s] = compIdx;
+                queue.push(s);
+
+                do {
+                    const node curNode = queue.front();
+                    queue.pop();
+                    forNeighborsInBucket(curNode, [&](node neighbor) {
+                        if (component[neighbor] == none) {
+                            queue.push(neighbor);
+                            component[neighbor] = compIdx;
+                            isTree[edgesMap.at(Edge(curNode, neighbor, true))] = true;
+                        }
+                    });
+                } while (!queue.empty());
+            }
+        }
+    }
+
+    // Large components are rebuilt one after another by a level-synchronous parallel BFS.
+    // Threads claim nodes with an atomic flag, the claiming thread adds the tree edge.
+    std::vector<std::atomic<bool>> claimed;
+    std::vector<node> frontier, nextFrontier;
+    for (index b = 0; b < numBuckets; ++b) {
+        if (bucketSize(b) < parallelRebuildSize)
+            continue;
+        if (claimed.empty()) {
+            claimed = std::vector<std::atomic<bool>>(G->upperNodeIdBound());
+#pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(claimed.size()); ++i)
+                claimed[i].store(false, std::memory_order_relaxed);
+        }
+
+        bool first = true;
+        for (index i = bucketBegin[b]; i < bucketBegin[b + 1]; ++i) {
+            const node s = bucketNodes[i];
+            if (claimed[s].load(std::memory_order_relaxed))
+                continue;
+
+            const index compIdx = first ? oldComponent[s] : nextComponent++;
+            first = false;
+            claimed[s].store(true, std::memory_order_relaxed);
+            component[s] = compIdx;
+            frontier.assign(1, s);
+
+            const auto visit = [&](node curNode, std::vector<node> &discovered) {
+                forNeighborsInBucket(curNode, [&](node neighbor) {
+                    if (!claimed[neighbor].load(std::memory_order_relaxed)
+                        && !claimed[neighbor].exchange(true, std::memory_order_relaxed)) {
+                        component[neighbor] = compIdx;
+                        isTree[edgesMap.at(Edge(curNode, neighbor, true))] = true;
+                        discovered.push_back(neighbor);
+                    }
+                });
+            };
+
+            while (!frontier.empty()) {
+                nextFrontier.clear();
+                if (frontier.size() < parallelFrontierSize) {
+                    // not worth a parallel region, e.g. on long paths
+                    for (const node u : frontier)
+                        visit(u, nextFrontier);
+                } else {
+#pragma omp parallel
+                    {
+                        std::vector<node> localFrontier;
+#pragma omp for schedule(guided) nowait
+                        for (omp_index j = 0; j < static_cast<omp_index>(frontier.size()); ++j)
+                            visit(frontier[j], localFrontier);
+#pragma omp critical
+                        nextFrontier.insert(nextFrontier.end(), localFrontier.begin(),
+                                            localFrontier.end());
+                    }
+                }
+                std::swap(frontier, nextFrontier);
+            }
+        }
+    }
+
+    component.setUpperBound(nextComponent.load());
+}
+
+template <bool WeaklyCC>
+void DynConnectedComponentsImpl<WeaklyCC>::mergeComponents(const std::vector<Edge> &insertions) {
+    auto &component = *componentPtr;
+    const count numLabels = component.upperBound();
+
+    // Concurrent union-find on the component ids. Roots are always linked below smaller roots,
+    // a successful link makes the inserted edge a spanning forest edge.
+    std::vector<std::atomic<index>> parent(numLabels);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(numLabels); ++i)
+        parent[i].store(static_cast<index>(i), std::memory_order_relaxed);
+
+    const auto find = [&](index x) -> index {
+        index p = parent[x].load(std::memory_order_relaxed);
+        while (p != x) {
+            const index gp = parent[p].load(std::memory_order_relaxed);
+            if (gp != p) // path halving
+                parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+            x = gp;
+            p = parent[x].load(std::memory_order_relaxed);
+        }
+        return x;
+    };
+
+#pragma omp parallel for schedule(guided)
+    for (omp_index i = 0; i < static_cast<omp_index>(insertions.size()); ++i) {
+        const Edge &edge = insertions[i];
+        // The edge might have been removed again later in the batch.
+        if (!G->hasEdge(edge.u, edge.v) && !G->hasEdge(edge.v, edge.u))
+            continue;
+
+        index a = find(component[edge.u]), b = find(component[edge.v]);
+        while (a != b) {
+            if (a < b)
+                std::swap(a, b);
+            index expected = a;
+            if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) {
+                isTree[edgesMap.at(edge)] = true;
+                break;
+            }
+            a = find(a);
+            b = find(b);
+        }
+    }
+
+    // Compact the component ids again.
+    std::vector<index> newId(numLabels, none);
+    G->parallelForNodes([&](node u) {
+        const index root = find(component[u]);
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic write
+#endif // NETWORKIT_OMP2
+        newId[root] = 0;
+    });
+    count numComponents = 0;
+    for (auto &id : newId)
+        if (id != none)
+            id = numComponents++;
+
+    G->parallelForNodes([&](node u) { component[u] = newId[find(component[u])]; });
+    component.setUpperBound(numComponents);
 }
 
 } // namespace DynConnectedComponentsDetails
@@ -18,6 +18,7 @@
 #include <networkit/graph/GraphTools.hpp>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/distance/Diameter.hpp>
 #include <networkit/generators/DorogovtsevMendesGenerator.hpp>
 #include <networkit/generators/HavelHakimiGenerator.hpp>
@@ -358,6 +359,82 @@ TEST_F(ConnectedComponentsGTest, testDynConnectedComponents) {
     }
 }
 
+namespace {
+// Applies random batches of edge insertions and removals to G and checks that the dynamic
+// algorithm agrees with the static one after each batch.
+template <class DynCC, class StaticCC>
+void checkDynComponentsBatches(Graph &G) {
+    Aux::Random::setSeed(42, false);
+    DynCC dyn(G);
+    dyn.run();
+
+    const auto checkComponents = [&]() {
+        StaticCC cc(G);
+        cc.run();
+        ASSERT_EQ(cc.numberOfComponents(), dyn.numberOfComponents());
+        std::unordered_map<index, index> compMap;
+        G.forNodes([&](node u) {
+            ASSERT_LT(dyn.componentOfNode(u), dyn.numberOfComponents());
+            const auto it = compMap.emplace(cc.componentOfNode(u), dyn.componentOfNode(u)).first;
+            EXPECT_EQ(it->second, dyn.componentOfNode(u));
+        });
+        EXPECT_EQ(compMap.size(), cc.numberOfComponents());
+    };
+
+    for (count round = 0; round < 30; ++round) {
+        std::vector<GraphEvent> batch;
+        const count batchSize = Aux::Random::integer(1, 60);
+        for (count i = 0; i < batchSize; ++i) {
+            // removals are more likely in the first rounds, insertions in the later ones
+            if (G.numberOfEdges() > 0 && Aux::Random::integer(29) >= round) {
+                const auto e = GraphTools::randomEdge(G);
+                G.removeEdge(e.first, e.second);
+                batch.emplace_back(GraphEvent::EDGE_REMOVAL, e.first, e.second);
+            } else {
+                const node u = GraphTools::randomNode(G), v = GraphTools::randomNode(G);
+                if (u == v || G.hasEdge(u, v) || G.hasEdge(v, u))
+                    continue;
+                G.addEdge(u, v);
+                batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+            }
+        }
+        dyn.updateBatch(batch);
+        checkComponents();
+
+        // single updates must still work on the spanning forest left by the batch
+        if (G.numberOfEdges() > 0) {
+            const auto e = GraphTools::randomEdge(G);
+            G.removeEdge(e.first, e.second);
+            dyn.update(GraphEvent(GraphEvent::EDGE_REMOVAL, e.first, e.second));
+            checkComponents();
+        }
+    }
+}
+} // namespace
+
+TEST_F(ConnectedComponentsGTest, testDynConnectedComponentsBatch) {
+    auto G = METISGraphReader{}.read("input/karate.graph");
+    checkDynComponentsBatches<DynConnectedComponents, ConnectedComponents>(G);
+}
+
+TEST_F(ConnectedComponentsGTest, testDynWeaklyConnectedComponentsBatch) {
+    auto G = KONECTGraphReader{}.read("input/foodweb-baydry.konect");
+    checkDynComponentsBatches<DynWeaklyConnectedComponents, WeaklyConnectedComponents>(G);
+}
+
+TEST_F(ConnectedComponentsGTest, testDynConnectedComponentsBatchLarge) {
+    // the giant component is large enough to be rebuilt by the parallel BFS
+    Aux::Random::setSeed(42, false);
+    auto G = ErdosRenyiGenerator(40000, 3.0 / 40000).generate();
+    checkDynComponentsBatches<DynConnectedComponents, ConnectedComponents>(G);
+}
+
+TEST_F(ConnectedComponentsGTest, testDynWeaklyConnectedComponentsBatchLarge) {
+    Aux::Random::setSeed(42, false);
+    auto G = ErdosRenyiGenerator(40000, 3.0 / 40000, true).generate();
+    checkDynComponentsBatches<DynWeaklyConnectedComponents, WeaklyConnectedComponents>(G);
+}
+
 TEST_F(ConnectedComponentsGTest, testDynConnectedComponentsDirected) {
     Graph g(0, false, true);
     EXPECT_THROW(DynConnectedComponents{g}, std::runtime_error);
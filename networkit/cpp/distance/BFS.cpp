@@ -5,8 +5,6 @@
  *      Author: Henning
  */
 
-#include <queue>
-
 #include <networkit/distance/BFS.hpp>
 
 namespace NetworKit {
@@ -15,37 +13,24 @@ BFS::BFS(const Graph &G, node source, bool storePaths, bool storeNodesSortedByDi
     : SSSP(G, source, storePaths, storeNodesSortedByDistance, target) {}
 
 void BFS::run() {
-    count z = G->upperNodeIdBound();
     reachedNodes = 1;
     sumDist = 0.;
 
     const auto infDist = std::numeric_limits<edgeweight>::max();
-    std::fill(distances.begin(), distances.end(), infDist);
-
-    if (distances.size() < z)
-        distances.resize(z, infDist);
-
-    if (storePaths) {
-        previous.clear();
-        previous.resize(z);
-        npaths.clear();
-        npaths.resize(z, 0);
-        npaths[source] = 1;
-    }
+    resetResults();
 
     if (storeNodesSortedByDistance) {
         std::vector<node> empty;
         std::swap(nodesSortedByDistance, empty);
     }
 
-    std::queue<node> q;
-    q.push(source);
+    // The touched nodes are appended in the order of discovery, so they also serve as queue
+    touchedNodes.push_back(source);
     distances[source] = 0.;
 
     bool breakWhenFound = (target != none);
-    while (!q.empty()) {
-        node u = q.front();
-        q.pop();
+    for (index i = 0; i < touchedNodes.size(); ++i) {
+        node u = touchedNodes[i];
 
         if (storeNodesSortedByDistance) {
             nodesSortedByDistance.push_back(u);
@@ -57,7 +42,7 @@ void BFS::run() {
         // insert untouched neighbors into queue
         G->forNeighborsOf(u, [&](node v) {
             if (distances[v] == infDist) {
-                q.push(v);
+                touchedNodes.push_back(v);
                 distances[v] = distances[u] + 1.;
                 sumDist += distances[v];
                 ++reachedNodes;
@@ -5,9 +5,14 @@
  *      Author: Daniel Hoske, Christian Staudt
  */
 
+#include <algorithm>
+#include <atomic>
 #include <numeric>
+#include <omp.h>
+#include <tlx/container/d_ary_addressable_int_heap.hpp>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/VectorComparator.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Diameter.hpp>
@@ -19,6 +24,10 @@
 
 namespace NetworKit {
 
+namespace {
+constexpr edgeweight infDist = std::numeric_limits<edgeweight>::max();
+} // namespace
+
 Diameter::Diameter(const Graph &G, DiameterAlgo algo, double error, count nSamples)
     : Algorithm(), G(&G), error(error), nSamples(nSamples) {
     if (algo == DiameterAlgo::AUTOMATIC) {
@@ -59,32 +68,208 @@ std::pair<count, count> Diameter::getDiameter() const {
 }
 
 edgeweight Diameter::exactDiameter(const Graph &G) {
-    using namespace std;
+    if (G.isEmpty())
+        return 0;
 
     Aux::SignalHandler handler;
 
-    edgeweight diameter = 0.0;
+    const bool directed = G.isDirected();
+    const bool weighted = G.isWeighted();
+    // Disconnected unweighted undirected graphs yield the maximum diameter of their connected
+    // components; in all other cases a single unreachable node makes the diameter infinite.
+    const bool requireConnected = directed || weighted;
+    const count n = G.upperNodeIdBound();
+
+    // Lower and upper bounds on the forward (and, for directed graphs, backward) eccentricities.
+    // Bound updates of concurrent searches are shared through atomic min/max operations.
+    std::vector<std::atomic<edgeweight>> eccLowerF(n), eccUpperF(n), eccLowerB, eccUpperB;
+    if (directed) {
+        eccLowerB = std::vector<std::atomic<edgeweight>>(n);
+        eccUpperB = std::vector<std::atomic<edgeweight>>(n);
+    }
+    G.parallelForNodes([&](node u) {
+        eccLowerF[u].store(0, std::memory_order_relaxed);
+        eccUpperF[u].store(infDist, std::memory_order_relaxed);
+        if (directed) {
+            eccLowerB[u].store(0, std::memory_order_relaxed);
+            eccUpperB[u].store(infDist, std::memory_order_relaxed);
+        }
+    });
+    std::atomic<edgeweight> diameterLowerBound{0};
+    std::atomic<bool> unreachable{false};
 
-    if (!G.isWeighted()) {
-        std::tie(diameter, std::ignore) = estimatedDiameterRange(G, 0);
-    } else {
-        G.forNodes([&](node v) {
-            handler.assureRunning();
-            Dijkstra dijkstra(G, v);
-            dijkstra.run();
-            auto distances = dijkstra.getDistances();
+    const auto totalDegree = [&](node u) -> count {
+        return directed ? G.degreeOut(u) + G.degreeIn(u) : G.degree(u);
+    };
+
+    const count maxThreads = static_cast<count>(omp_get_max_threads());
+    std::vector<std::vector<edgeweight>> forwardDist(maxThreads), backwardDist(maxThreads);
+    std::vector<std::vector<node>> reachedForward(maxThreads), reachedBackward(maxThreads);
+
+    // Computes the distances from (or, if reverse is set, to) source and returns the
+    // eccentricity. Distances of unreached nodes remain infDist.
+    const auto search = [&](node source, bool reverse, std::vector<edgeweight> &dist,
+                            std::vector<node> &reached) -> edgeweight {
+        dist.resize(n, infDist);
+        for (node u : reached)
+            dist[u] = infDist;
+        reached.clear();
+
+        dist[source] = 0;
+        reached.push_back(source);
+        const auto relax = [&](node u, node v, edgeweight w) -> bool {
+            if (dist[u] + w >= dist[v])
+                return false;
+            if (dist[v] == infDist)
+                reached.push_back(v);
+            dist[v] = dist[u] + w;
+            return true;
+        };
+
+        if (!weighted) {
+            // BFS: the reached nodes double as the queue.
+            for (index i = 0; i < reached.size(); ++i) {
+                const node u = reached[i];
+                const auto visit = [&](node v) {
+                    if (dist[v] == infDist) {
+                        dist[v] = dist[u] + 1;
+                        reached.push_back(v);
+                    }
+                };
+                if (reverse)
+                    G.forInNeighborsOf(u, visit);
+                else
+                    G.forNeighborsOf(u, visit);
+            }
+        } else {
+            tlx::d_ary_addressable_int_heap<node, 2, Aux::LessInVector<edgeweight>> heap{dist};
+            heap.push(source);
+            while (!heap.empty()) {
+                const node u = heap.extract_top();
+                const auto visit = [&](node v, edgeweight w) {
+                    if (relax(u, v, w))
+                        heap.update(v);
+                };
+                if (reverse)
+                    G.forInNeighborsOf(u, visit);
+                else
+                    G.forNeighborsOf(u, visit);
+            }
+        }
+
+        if (reached.size() < G.numberOfNodes() && requireConnected)
+            unreachable.store(true, std::memory_order_relaxed);
+
+        edgeweight ecc = 0;
+        for (node u : reached)
+            ecc = std::max(ecc, dist[u]);
+        return ecc;
+    };
+
+    const auto atomicMin = [](std::atomic<edgeweight> &x, edgeweight value) {
+        edgeweight cur = x.load(std::memory_order_relaxed);
+        while (value < cur && !x.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+        }
+    };
+    const auto atomicMax = [](std::atomic<edgeweight> &x, edgeweight value) {
+        edgeweight cur = x.load(std::memory_order_relaxed);
+        while (value > cur && !x.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+        }
+    };
+
+    // Computes the exact eccentricities of source and uses them to tighten the bounds of all
+    // nodes that reach source (resp. are reached by it).
+    const auto processSource = [&](node source) {
+        const index tid = omp_get_thread_num();
+        auto &distF = forwardDist[tid], &distB = backwardDist[tid];
+        const edgeweight eccF = search(source, false, distF, reachedForward[tid]);
+        if (!directed) {
+            atomicMax(diameterLowerBound, eccF);
+            for (node u : reachedForward[tid]) {
+                // ecc(u) <= d(u, source) + ecc(source) and ecc(u) >= max(d, ecc(source) - d)
+                atomicMin(eccUpperF[u], distF[u] + eccF);
+                atomicMax(eccLowerF[u], std::max(distF[u], eccF - distF[u]));
+            }
+            return;
+        }
+
+        const edgeweight eccB = search(source, true, distB, reachedBackward[tid]);
+        atomicMax(diameterLowerBound, std::max(eccF, eccB));
+        // eccF(u) <= d(u, source) + eccF(source) and eccF(u) >= d(u, source)
+        for (node u : reachedBackward[tid]) {
+            atomicMin(eccUpperF[u], distB[u] + eccF);
+            atomicMax(eccLowerF[u], distB[u]);
+        }
+        // eccB(u) <= d(source, u) + eccB(source) and eccB(u) >= d(source, u)
+        for (node u : reachedForward[tid]) {
+            atomicMin(eccUpperB[u], distF[u] + eccB);
+            atomicMax(eccLowerB[u], distF[u]);
+        }
+    };
+
+    // The diameter equals the maximum forward eccentricity and, for directed graphs, also the
+    // maximum backward eccentricity. Nodes whose upper bound does not exceed the best lower bound
+    // cannot raise it any further; we are done as soon as no such node is left on one side.
+    std::vector<node> candidates;
+    count numSearches = 0;
+    for (count round = 0;; ++round) {
+        handler.assureRunning();
+        const edgeweight lb = diameterLowerBound.load(std::memory_order_relaxed);
+
+        bool backward = false;
+        candidates.clear();
+        G.forNodes([&](node u) {
+            if (eccUpperF[u].load(std::memory_order_relaxed) > lb)
+                candidates.push_back(u);
+        });
+        if (directed && !candidates.empty()) {
+            std::vector<node> candidatesB;
             G.forNodes([&](node u) {
-                if (diameter < distances[u]) {
-                    diameter = distances[u];
-                }
+                if (eccUpperB[u].load(std::memory_order_relaxed) > lb)
+                    candidatesB.push_back(u);
             });
-        });
+            if (candidatesB.size() < candidates.size()) {
+                candidates.swap(candidatesB);
+                backward = true;
+            }
+        }
+        if (candidates.empty())
+            break;
+
+        const auto &lower = backward ? eccLowerB : eccLowerF;
+        const auto &upper = backward ? eccUpperB : eccUpperF;
+        const count batchSize = std::min<count>(maxThreads, candidates.size());
+        // Alternate between nodes that are likely peripheral (large upper bound) and nodes that
+        // are likely central (small lower bound), preferring high-degree nodes on ties.
+        const auto peripheral = [&](node u, node v) {
+            const edgeweight bu = upper[u].load(std::memory_order_relaxed),
+                             bv = upper[v].load(std::memory_order_relaxed);
+            return bu > bv || (bu == bv && totalDegree(u) > totalDegree(v));
+        };
+        const auto central = [&](node u, node v) {
+            const edgeweight bu = lower[u].load(std::memory_order_relaxed),
+                             bv = lower[v].load(std::memory_order_relaxed);
+            return bu < bv || (bu == bv && totalDegree(u) > totalDegree(v));
+        };
+        if (round % 2 == 0)
+            std::partial_sort(candidates.begin(), candidates.begin() + batchSize, candidates.end(),
+                              peripheral);
+        else
+            std::partial_sort(candidates.begin(), candidates.begin() + batchSize, candidates.end(),
+                              central);
+
+#pragma omp parallel for schedule(dynamic, 1)
+        for (omp_index i = 0; i < static_cast<omp_index>(batchSize); ++i)
+            processSource(candidates[i]);
+        numSearches += batchSize;
+
+        if (unreachable.load(std::memory_order_relaxed))
+            throw std::runtime_error("Graph not connected - diameter is infinite");
     }
 
-    if (diameter == std::numeric_limits<edgeweight>::max()) {
-        throw std::runtime_error("Graph not connected - diameter is infinite");
-    }
-    return diameter;
+    INFO(numSearches, " sources used");
+
+    return diameterLowerBound.load(std::memory_order_relaxed);
 }
 
 std::pair<edgeweight, edgeweight> Diameter::estimatedDiameterRange(const Graph &G, double error) {
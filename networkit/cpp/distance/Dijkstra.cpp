@@ -22,30 +22,24 @@ void Dijkstra::run() {
 
     // init distances
     auto infDist = std::numeric_limits<edgeweight>::max();
-    std::fill(distances.begin(), distances.end(), infDist);
-
-    if (distances.size() < G->upperNodeIdBound())
-        distances.resize(G->upperNodeIdBound(), infDist);
+    resetResults();
 
     sumDist = 0.;
     reachedNodes = 1;
 
-    if (storePaths) {
-        previous.clear();
-        previous.resize(G->upperNodeIdBound());
-        npaths.clear();
-        npaths.resize(G->upperNodeIdBound(), 0);
-        npaths[source] = 1;
-    }
-
     if (storeNodesSortedByDistance) {
         nodesSortedByDistance.clear();
         nodesSortedByDistance.reserve(G->upperNodeIdBound());
     }
 
+    // Nodes left over by a run that stopped at the target; unlike clear(), this does not touch
+    // the handles of all nodes.
+    while (!heap.empty())
+        heap.pop();
+
     // priority queue with distance-node pairs
     distances[source] = 0.;
-    heap.clear();
+    touchedNodes.push_back(source);
     heap.push(source);
 
     auto initPath = [&](node u, node v) {
@@ -72,6 +66,7 @@ void Dijkstra::run() {
             double newDist = distances[u] + w;
             if (distances[v] == infDist) {
                 distances[v] = newDist;
+                touchedNodes.push_back(v);
                 heap.push(v);
                 ++reachedNodes;
                 if (storePaths)
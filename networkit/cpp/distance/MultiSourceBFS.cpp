@@ -0,0 +1,100 @@
+/*
+ * MultiSourceBFS.cpp
+ */
+
+#include <tlx/math/ffs.hpp>
+
+#include <networkit/distance/MultiSourceBFS.hpp>
+
+namespace NetworKit {
+
+MultiSourceBFS::MultiSourceBFS(const Graph &G)
+    : G(&G), seen(G.upperNodeIdBound()), frontier(G.upperNodeIdBound()),
+      next(G.upperNodeIdBound()) {}
+
+void MultiSourceBFS::pushLevel(Mask active, LevelCounts &found) {
+#pragma omp parallel
+    {
+        std::vector<node> localNodes;
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(frontierNodes.size()); ++i) {
+            const node u = frontierNodes[i];
+            const Mask bits = frontier[u] & active;
+            if (!bits)
+                continue;
+
+            // seen is not modified before the barrier, so reading it here is race-free.
+            G->forNeighborsOf(u, [&](node w) {
+                const Mask reached = bits & ~seen[w];
+                if (!reached)
+                    return;
+                Mask old;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic capture
+#else
+#pragma omp critical(MultiSourceBFSNext)
+#endif // NETWORKIT_OMP2
+                {
+                    old = next[w];
+                    next[w] |= reached;
+                }
+                if (!old)
+                    localNodes.push_back(w);
+            });
+        }
+
+#pragma omp critical
+        nextNodes.insert(nextNodes.end(), localNodes.begin(), localNodes.end());
+#pragma omp barrier
+
+        LevelCounts localFound{};
+#pragma omp for schedule(static)
+        for (omp_index i = 0; i < static_cast<omp_index>(nextNodes.size()); ++i) {
+            const node w = nextNodes[i];
+            seen[w] |= next[w];
+            for (Mask bits = next[w]; bits; bits &= bits - 1)
+                ++localFound[tlx::ffs(bits) - 1];
+        }
+
+#pragma omp critical
+        for (index j = 0; j < maxSources; ++j)
+            found[j] += localFound[j];
+    }
+}
+
+void MultiSourceBFS::pullLevel(Mask active, LevelCounts &found) {
+    const count z = G->upperNodeIdBound();
+#pragma omp parallel
+    {
+        std::vector<node> localNodes;
+        LevelCounts localFound{};
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+            const node w = static_cast<node>(i);
+            const Mask missing = active & ~seen[w];
+            if (!missing || !G->hasNode(w))
+                continue;
+
+            Mask reached = 0;
+            G->forInNeighborsOf(w, [&](node u) { reached |= frontier[u]; });
+            reached &= missing;
+            if (!reached)
+                continue;
+
+            next[w] = reached;
+            seen[w] |= reached;
+            localNodes.push_back(w);
+            for (Mask bits = reached; bits; bits &= bits - 1)
+                ++localFound[tlx::ffs(bits) - 1];
+        }
+
+#pragma omp critical
+        {
+            nextNodes.insert(nextNodes.end(), localNodes.begin(), localNodes.end());
+            for (index j = 0; j < maxSources; ++j)
+                found[j] += localFound[j];
+        }
+    }
+}
+
+} // namespace NetworKit
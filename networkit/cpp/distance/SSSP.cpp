@@ -5,6 +5,9 @@
  *      Author: cls
  */
 
+#include <algorithm>
+#include <limits>
+
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/distance/SSSP.hpp>
 
@@ -19,6 +22,45 @@ const std::vector<edgeweight> &SSSP::getDistances() {
     return distances;
 }
 
+const std::vector<node> &SSSP::getTouchedNodes() const {
+    assureFinished();
+    if (!touchedNodesValid)
+        throw std::runtime_error("Error: touched nodes have not been recorded.");
+    return touchedNodes;
+}
+
+void SSSP::resetResults() {
+    const count z = G->upperNodeIdBound();
+    constexpr edgeweight infDist = std::numeric_limits<edgeweight>::max();
+
+    if (touchedNodesValid) {
+        for (const node u : touchedNodes) {
+            distances[u] = infDist;
+            if (storePaths) {
+                previous[u].clear();
+                npaths[u] = 0;
+            }
+        }
+    } else {
+        std::fill(distances.begin(), distances.end(), infDist);
+        if (storePaths) {
+            previous.clear();
+            npaths.clear();
+        }
+    }
+
+    // The graph may have grown since the last run
+    distances.resize(z, infDist);
+    if (storePaths) {
+        previous.resize(z);
+        npaths.resize(z, 0);
+        npaths[source] = 1;
+    }
+
+    touchedNodes.clear();
+    touchedNodesValid = true;
+}
+
 std::vector<node> SSSP::getPath(node t, bool forward) const {
     if (!storePaths) {
         throw std::runtime_error("paths have not been stored");
@@ -368,6 +368,42 @@ TEST_F(DistanceGTest, testExactDiameter) {
     }
 }
 
+TEST_P(DistanceGTest, testExactDiameterDirectedWeighted) {
+    Aux::Random::setSeed(42, false);
+    for (count n : {1, 2, 50, 300}) {
+        auto G = generateERGraph(n, 0.02);
+        // Make the graph (strongly) connected.
+        for (node u = 0; u < n; ++u)
+            if (!G.hasEdge(u, (u + 1) % n))
+                G.addEdge(u, (u + 1) % n);
+        if (isWeighted())
+            G.forEdges(
+                [&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 10)); });
+
+        APSP apsp(G);
+        apsp.run();
+        edgeweight expected = 0;
+        G.forNodes([&](node u) {
+            G.forNodes([&](node v) { expected = std::max(expected, apsp.getDistance(u, v)); });
+        });
+
+        Diameter diam(G, DiameterAlgo::EXACT);
+        diam.run();
+        EXPECT_EQ(diam.getDiameter().first, static_cast<count>(expected));
+    }
+
+    Graph G(4, isWeighted(), isDirected());
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+    Diameter diam(G, DiameterAlgo::EXACT);
+    if (isDirected() || isWeighted()) {
+        EXPECT_THROW(diam.run(), std::runtime_error);
+    } else {
+        diam.run();
+        EXPECT_EQ(diam.getDiameter().first, 2u);
+    }
+}
+
 TEST_F(DistanceGTest, testEstimatedDiameterRange) {
     using namespace std;
 
@@ -14,6 +14,9 @@
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/DynBFS.hpp>
 #include <networkit/distance/DynDijkstra.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 
 #include <tlx/unused.hpp>
@@ -194,4 +197,89 @@ TEST_F(SSSPGTest, testDirectedDijkstra) {
     EXPECT_EQ(sssp.distance(6), 1);
     EXPECT_EQ(sssp.distance(7), 3);
 }
+
+TEST_F(SSSPGTest, testReusedSSSPLazyReset) {
+    Aux::Random::setSeed(42, false);
+    for (const bool directed : {false, true}) {
+        Graph G = GraphTools::toWeighted(ErdosRenyiGenerator(300, 0.01, directed).generate());
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 5)); });
+        const node target = GraphTools::randomNode(G);
+
+        // Runs from different sources with the same objects must give the same results as
+        // fresh objects, also after runs that stopped at the target.
+        BFS bfs(G, 0, true, false, target);
+        Dijkstra dij(G, 0, true, false, target);
+        for (count i = 0; i < 20; ++i) {
+            const node source = GraphTools::randomNode(G);
+            BFS freshBFS(G, source, true, false, target);
+            Dijkstra freshDij(G, source, true, false, target);
+            SSSP *reused[] = {&bfs, &dij};
+            SSSP *fresh[] = {&freshBFS, &freshDij};
+
+            for (index j = 0; j < 2; ++j) {
+                reused[j]->setSource(source);
+                reused[j]->run();
+                fresh[j]->run();
+                EXPECT_EQ(reused[j]->getDistances(), fresh[j]->getDistances());
+
+                const auto &touched = reused[j]->getTouchedNodes();
+                std::vector<bool> isTouched(G.upperNodeIdBound());
+                for (const node u : touched)
+                    isTouched[u] = true;
+                EXPECT_EQ(static_cast<count>(std::count(isTouched.begin(), isTouched.end(), true)),
+                          touched.size());
+                G.forNodes([&](node u) {
+                    EXPECT_EQ(isTouched[u], reused[j]->distance(u)
+                                                != std::numeric_limits<edgeweight>::max());
+                    EXPECT_EQ(reused[j]->numberOfPaths(u), fresh[j]->numberOfPaths(u));
+                    EXPECT_EQ(reused[j]->getPredecessors(u), fresh[j]->getPredecessors(u));
+                });
+            }
+        }
+    }
+}
+
+TEST_F(SSSPGTest, testMultiSourceBFS) {
+    for (bool directed : {false, true}) {
+        // Sparse enough that both the push and the pull levels are used.
+        Aux::Random::setSeed(42, false);
+        const Graph G = ErdosRenyiGenerator(2000, 1.5 / 2000., directed).generate();
+
+        std::vector<node> sources;
+        for (node s = 0; s < MultiSourceBFS::maxSources; ++s)
+            sources.push_back(3 * s);
+
+        std::vector<std::vector<count>> expected(sources.size());
+        for (index i = 0; i < sources.size(); ++i) {
+            BFS bfs(G, sources[i]);
+            bfs.run();
+            G.forNodes([&](node v) {
+                const double d = bfs.distance(v);
+                if (d == std::numeric_limits<double>::max() || d == 0)
+                    return;
+                const auto level = static_cast<index>(d);
+                if (expected[i].size() <= level)
+                    expected[i].resize(level + 1);
+                ++expected[i][level];
+            });
+        }
+
+        MultiSourceBFS msbfs(G);
+        std::vector<std::vector<count>> actual(sources.size());
+        msbfs.run(sources, [&](count level, const auto &found) {
+            for (index i = 0; i < sources.size(); ++i) {
+                if (!found[i])
+                    continue;
+                if (actual[i].size() <= level)
+                    actual[i].resize(level + 1);
+                actual[i][level] = found[i];
+            }
+            return MultiSourceBFS::Mask{0};
+        });
+
+        for (index i = 0; i < sources.size(); ++i)
+            EXPECT_EQ(actual[i], expected[i]);
+    }
+}
+
 } // namespace NetworKit
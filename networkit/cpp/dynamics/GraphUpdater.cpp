@@ -5,56 +5,316 @@
  *      Author: cls
  */
 
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <sstream>
+#include <tuple>
+
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/dynamics/GraphUpdater.hpp>
 
 namespace NetworKit {
 
+namespace {
+
+bool isEdgeEvent(GraphEvent::Type type) {
+    return type == GraphEvent::EDGE_ADDITION || type == GraphEvent::EDGE_REMOVAL
+           || type == GraphEvent::EDGE_WEIGHT_UPDATE || type == GraphEvent::EDGE_WEIGHT_INCREMENT;
+}
+
+// Net effect of all events of an edge batch on a single edge.
+struct EdgeChange {
+    enum Kind : unsigned char { NONE, ADDITION, REMOVAL, WEIGHT_UPDATE };
+    node u, v;
+    edgeweight w;
+    Kind kind;
+};
+
+// Change to the adjacency array of a single node; each EdgeChange yields up to two of them.
+struct HalfEdgeChange {
+    node owner, other;
+    edgeweight w;
+    edgeid id;
+    bool incoming, removal;
+};
+
+} // namespace
+
 GraphUpdater::GraphUpdater(Graph &G) : G(&G) {}
 
 void GraphUpdater::update(const std::vector<GraphEvent> &stream) {
-    for (GraphEvent ev : stream) {
-        TRACE("event: ", ev.toString());
-        switch (ev.type) {
-        case GraphEvent::NODE_ADDITION: {
-            G->addNode();
-            break;
-        }
-        case GraphEvent::NODE_REMOVAL: {
-            G->removeNode(ev.u);
-            break;
-        }
-        case GraphEvent::NODE_RESTORATION: {
-            G->restoreNode(ev.u);
-            break;
-        }
-        case GraphEvent::EDGE_ADDITION: {
-            G->addEdge(ev.u, ev.v, ev.w);
-            break;
-        }
-        case GraphEvent::EDGE_REMOVAL: {
-            G->removeEdge(ev.u, ev.v);
-            break;
-        }
-        case GraphEvent::EDGE_WEIGHT_UPDATE: {
-            G->setWeight(ev.u, ev.v, ev.w);
-            break;
+    for (const GraphEvent &ev : stream)
+        applyEvent(ev);
+    // record graph size
+    size.emplace_back(G->numberOfNodes(), G->numberOfEdges());
+}
+
+void GraphUpdater::updateBatch(const std::vector<GraphEvent> &stream) {
+    for (index i = 0; i < stream.size();) {
+        if (!isEdgeEvent(stream[i].type)) {
+            applyEvent(stream[i++]);
+            continue;
         }
-        case GraphEvent::EDGE_WEIGHT_INCREMENT: {
-            G->setWeight(ev.u, ev.v, G->weight(ev.u, ev.v) + ev.w);
-            break;
+
+        index end = i + 1;
+        while (end < stream.size() && isEdgeEvent(stream[end].type))
+            ++end;
+        applyEdgeBatch(stream, i, end);
+        i = end;
+    }
+    // record graph size
+    size.emplace_back(G->numberOfNodes(), G->numberOfEdges());
+}
+
+void GraphUpdater::applyEvent(const GraphEvent &ev) {
+    TRACE("event: ", ev.toString());
+    switch (ev.type) {
+    case GraphEvent::NODE_ADDITION: {
+        G->addNode();
+        break;
+    }
+    case GraphEvent::NODE_REMOVAL: {
+        G->removeNode(ev.u);
+        break;
+    }
+    case GraphEvent::NODE_RESTORATION: {
+        G->restoreNode(ev.u);
+        break;
+    }
+    case GraphEvent::EDGE_ADDITION: {
+        G->addEdge(ev.u, ev.v, ev.w);
+        break;
+    }
+    case GraphEvent::EDGE_REMOVAL: {
+        G->removeEdge(ev.u, ev.v);
+        break;
+    }
+    case GraphEvent::EDGE_WEIGHT_UPDATE: {
+        G->setWeight(ev.u, ev.v, ev.w);
+        break;
+    }
+    case GraphEvent::EDGE_WEIGHT_INCREMENT: {
+        G->setWeight(ev.u, ev.v, G->weight(ev.u, ev.v) + ev.w);
+        break;
+    }
+    case GraphEvent::TIME_STEP: {
+        G->timeStep();
+        break;
+    }
+    default: {
+        throw std::runtime_error("unknown event type");
+    }
+    }
+}
+
+void GraphUpdater::applyEdgeBatch(const std::vector<GraphEvent> &stream, index begin,
+                                  index end) {
+    const bool directed = G->isDirected();
+    const bool weighted = G->isWeighted();
+
+    if (G->getMaintainCompactEdges() && !G->hasEdgeIds())
+        throw std::runtime_error("Edges have to be indexed if maintainCompactEdges is set to true");
+
+    const auto endpoints = [&](index i) -> std::pair<node, node> {
+        const GraphEvent &ev = stream[i];
+        if (!directed && ev.v < ev.u)
+            return {ev.v, ev.u};
+        return {ev.u, ev.v};
+    };
+
+    // Group the events by edge; ties are broken by stream position to preserve the order of the
+    // events of each edge.
+    std::vector<index> order(end - begin);
+    std::iota(order.begin(), order.end(), begin);
+    Aux::Parallel::sort(order.begin(), order.end(), [&](index a, index b) {
+        return std::make_pair(endpoints(a), a) < std::make_pair(endpoints(b), b);
+    });
+
+    std::vector<index> groupBegin;
+    for (index i = 0; i < order.size(); ++i)
+        if (i == 0 || endpoints(order[i]) != endpoints(order[i - 1]))
+            groupBegin.push_back(i);
+    const count numGroups = groupBegin.size();
+    groupBegin.push_back(order.size());
+
+    // Collapse the events of each edge into their net effect.
+    std::vector<EdgeChange> changes(numGroups);
+    index firstInvalid = none;
+    std::string invalidReason;
+
+#pragma omp parallel for schedule(guided)
+    for (omp_index g = 0; g < static_cast<omp_index>(numGroups); ++g) {
+        const auto uv = endpoints(order[groupBegin[g]]);
+        const node u = uv.first, v = uv.second;
+        const bool wasPresent = G->hasEdge(u, v);
+        const edgeweight oldWeight = wasPresent ? G->weight(u, v) : nullWeight;
+        bool present = wasPresent;
+        edgeweight w = oldWeight;
+
+        for (index i = groupBegin[g]; i < groupBegin[g + 1]; ++i) {
+            const GraphEvent &ev = stream[order[i]];
+            std::string reason;
+            switch (ev.type) {
+            case GraphEvent::EDGE_ADDITION:
+                if (present)
+                    reason = "already exists, batch updates do not support multi-edges";
+                present = true;
+                w = ev.w;
+                break;
+            case GraphEvent::EDGE_REMOVAL:
+                if (!present)
+                    reason = "does not exist";
+                present = false;
+                break;
+            case GraphEvent::EDGE_WEIGHT_UPDATE:
+            case GraphEvent::EDGE_WEIGHT_INCREMENT:
+                if (!weighted)
+                    reason = "cannot be reweighted in an unweighted graph";
+                // Like Graph::setWeight, updating the weight of a missing edge creates it.
+                if (ev.type == GraphEvent::EDGE_WEIGHT_UPDATE)
+                    w = ev.w;
+                else
+                    w = (present ? w : nullWeight) + ev.w;
+                present = true;
+                break;
+            default:
+                assert(false);
+                break;
+            }
+
+            if (!reason.empty()) {
+#pragma omp critical
+                {
+                    if (order[i] < firstInvalid) {
+                        firstInvalid = order[i];
+                        std::stringstream strm;
+                        strm << "edge (" << ev.u << "," << ev.v << ") " << reason;
+                        invalidReason = strm.str();
+                    }
+                }
+                break;
+            }
         }
-        case GraphEvent::TIME_STEP: {
-            G->timeStep();
-            break;
+
+        auto &change = changes[g];
+        change.u = u;
+        change.v = v;
+        change.w = w;
+        if (wasPresent && !present)
+            change.kind = EdgeChange::REMOVAL;
+        else if (!wasPresent && present)
+            change.kind = EdgeChange::ADDITION;
+        else if (present && weighted && w != oldWeight)
+            change.kind = EdgeChange::WEIGHT_UPDATE;
+        else
+            change.kind = EdgeChange::NONE;
+    }
+
+    if (firstInvalid != none)
+        throw std::runtime_error(invalidReason);
+
+    // Weight updates only write the weight entries of their own edge and can hence run
+    // concurrently.
+#pragma omp parallel for
+    for (omp_index g = 0; g < static_cast<omp_index>(numGroups); ++g) {
+        const auto &change = changes[g];
+        if (change.kind == EdgeChange::WEIGHT_UPDATE)
+            G->setWeight(change.u, change.v, change.w);
+    }
+
+    // Split additions and removals into changes of single adjacency arrays.
+    std::vector<HalfEdgeChange> halfEdges;
+    count addedEdges = 0, removedEdges = 0, addedSelfLoops = 0, removedSelfLoops = 0;
+    edgeid nextId = G->upperEdgeIdBound();
+    for (const auto &change : changes) {
+        if (change.kind != EdgeChange::ADDITION && change.kind != EdgeChange::REMOVAL)
+            continue;
+
+        const bool removal = (change.kind == EdgeChange::REMOVAL);
+        const bool selfLoop = (change.u == change.v);
+        const edgeid id = (G->hasEdgeIds() && !removal) ? nextId++ : none;
+        if (removal) {
+            ++removedEdges;
+            removedSelfLoops += selfLoop;
+        } else {
+            ++addedEdges;
+            addedSelfLoops += selfLoop;
         }
-        default: {
-            throw std::runtime_error("unknown event type");
+
+        halfEdges.push_back({change.u, change.v, change.w, id, false, removal});
+        if (directed)
+            halfEdges.push_back({change.v, change.u, change.w, id, true, removal});
+        else if (!selfLoop)
+            halfEdges.push_back({change.v, change.u, change.w, id, false, removal});
+    }
+
+    Aux::Parallel::sort(halfEdges.begin(), halfEdges.end(),
+                        [](const HalfEdgeChange &a, const HalfEdgeChange &b) {
+                            // removals first, see below
+                            return std::make_tuple(a.owner, a.incoming, !a.removal, a.other)
+                                   < std::make_tuple(b.owner, b.incoming, !b.removal, b.other);
+                        });
+
+    std::vector<index> arrayBegin;
+    for (index i = 0; i < halfEdges.size(); ++i)
+        if (i == 0 || halfEdges[i].owner != halfEdges[i - 1].owner
+            || halfEdges[i].incoming != halfEdges[i - 1].incoming)
+            arrayBegin.push_back(i);
+    const count numArrays = arrayBegin.size();
+    arrayBegin.push_back(halfEdges.size());
+
+    // Each adjacency array is modified by exactly one thread.
+#pragma omp parallel for schedule(guided)
+    for (omp_index a = 0; a < static_cast<omp_index>(numArrays); ++a) {
+        const auto first = halfEdges.begin() + arrayBegin[a];
+        const auto last = halfEdges.begin() + arrayBegin[a + 1];
+        const node owner = first->owner;
+        const bool incoming = first->incoming;
+        // Removals precede additions and are sorted by their other endpoint.
+        const auto firstAddition = std::find_if(
+            first, last, [](const HalfEdgeChange &change) { return !change.removal; });
+
+        if (first != firstAddition) {
+            // Remove only one copy of each edge, even if the graph already has multi-edges.
+            std::vector<bool> removed(firstAddition - first, false);
+            G->removeAdjacentEdges(
+                owner,
+                [&](node x) {
+                    const auto it = std::lower_bound(
+                        first, firstAddition, x,
+                        [](const HalfEdgeChange &change, node y) { return change.other < y; });
+                    if (it == firstAddition || it->other != x || removed[it - first])
+                        return false;
+                    removed[it - first] = true;
+                    return true;
+                },
+                incoming);
         }
+
+        for (auto it = firstAddition; it != last; ++it) {
+            const edgeid id = G->hasEdgeIds() ? it->id : 0;
+            if (!directed)
+                G->addPartialEdge(unsafe, owner, it->other, it->w, id);
+            else if (incoming)
+                G->addPartialInEdge(unsafe, owner, it->other, it->w, id);
+            else
+                G->addPartialOutEdge(unsafe, owner, it->other, it->w, id);
         }
     }
-    // record graph size
-    size.emplace_back(G->numberOfNodes(), G->numberOfEdges());
+
+    G->setEdgeCount(unsafe, G->numberOfEdges() + addedEdges - removedEdges);
+    G->setNumberOfSelfLoops(unsafe, G->numberOfSelfLoops() + addedSelfLoops - removedSelfLoops);
+    if (G->hasEdgeIds())
+        G->setUpperEdgeIdBound(unsafe, nextId);
+
+    if (removedEdges > 0) {
+        if (G->getKeepEdgesSorted())
+            G->sortEdges();
+        if (G->getMaintainCompactEdges())
+            G->indexEdges(true);
+    }
 }
 
 const std::vector<std::pair<count, count>> &GraphUpdater::getSizeTimeline() const {
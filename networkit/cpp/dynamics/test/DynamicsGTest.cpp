@@ -7,7 +7,10 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/dynamics/DGSStreamParser.hpp>
 #include <networkit/dynamics/DGSWriter.hpp>
 #include <networkit/dynamics/GraphDifference.hpp>
@@ -237,4 +240,100 @@ TEST_F(DynamicsGTest, testGraphDifferenceDirectedWeighted) {
     }
 }
 
+TEST_F(DynamicsGTest, testGraphUpdaterBatch) {
+    Aux::Random::setSeed(42, false);
+    for (const bool directed : {false, true}) {
+        for (const bool weighted : {false, true}) {
+            constexpr count n = 50;
+            Graph G(n, weighted, directed);
+            std::set<std::pair<node, node>> edges;
+            const auto key = [&](node u, node v) {
+                return (directed || u <= v) ? std::make_pair(u, v) : std::make_pair(v, u);
+            };
+
+            // random stream without multi-edges, interleaved with node events and time steps
+            std::vector<GraphEvent> stream;
+            count numNodes = n;
+            for (count i = 0; i < 5000; ++i) {
+                if (i % 500 == 499) {
+                    stream.emplace_back(GraphEvent::NODE_ADDITION);
+                    stream.emplace_back(GraphEvent::TIME_STEP);
+                    ++numNodes;
+                    continue;
+                }
+                const node u = Aux::Random::index(numNodes);
+                const node v = Aux::Random::index(numNodes);
+                const edgeweight w = weighted ? Aux::Random::real(1, 10) : defaultEdgeWeight;
+                if (!edges.count(key(u, v))) {
+                    stream.emplace_back(GraphEvent::EDGE_ADDITION, u, v, w);
+                    edges.insert(key(u, v));
+                } else if (weighted && Aux::Random::real() < 0.3) {
+                    stream.emplace_back(Aux::Random::real() < 0.5
+                                            ? GraphEvent::EDGE_WEIGHT_UPDATE
+                                            : GraphEvent::EDGE_WEIGHT_INCREMENT,
+                                        u, v, w);
+                } else {
+                    stream.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
+                    edges.erase(key(u, v));
+                }
+            }
+
+            Graph sequential = G;
+            GraphUpdater(sequential).update(stream);
+            Graph batched = G;
+            GraphUpdater batchUpdater(batched);
+            batchUpdater.updateBatch(stream);
+
+            EXPECT_TRUE(batched.checkConsistency());
+            EXPECT_EQ(batched.numberOfSelfLoops(), sequential.numberOfSelfLoops());
+            expect_graph_equals(batched, sequential);
+            batched.forEdges([&](node u, node v, edgeweight w) {
+                EXPECT_DOUBLE_EQ(w, sequential.weight(u, v));
+            });
+            ASSERT_EQ(batchUpdater.getSizeTimeline().size(), 1);
+            EXPECT_EQ(batchUpdater.getSizeTimeline().front().second, edges.size());
+        }
+    }
+}
+
+TEST_F(DynamicsGTest, testGraphUpdaterBatchIndexedEdges) {
+    Graph G(4, false, false, true);
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+
+    GraphUpdater updater(G);
+    updater.updateBatch({{GraphEvent::EDGE_ADDITION, 2, 3},
+                         {GraphEvent::EDGE_REMOVAL, 0, 1},
+                         {GraphEvent::EDGE_ADDITION, 1, 0},
+                         {GraphEvent::EDGE_REMOVAL, 2, 1},
+                         {GraphEvent::EDGE_ADDITION, 3, 3}});
+
+    EXPECT_EQ(G.numberOfEdges(), 3);
+    EXPECT_EQ(G.numberOfSelfLoops(), 1);
+    EXPECT_TRUE(G.hasEdge(0, 1));
+    EXPECT_FALSE(G.hasEdge(1, 2));
+    EXPECT_TRUE(G.hasEdge(2, 3));
+    EXPECT_TRUE(G.hasEdge(3, 3));
+    EXPECT_EQ(G.upperEdgeIdBound(), 4);
+    EXPECT_NE(G.edgeId(2, 3), G.edgeId(3, 3));
+    EXPECT_TRUE(G.checkConsistency());
+}
+
+TEST_F(DynamicsGTest, testGraphUpdaterBatchRejectsInvalidEvents) {
+    Graph G(3);
+    G.addEdge(0, 1);
+    GraphUpdater updater(G);
+
+    EXPECT_THROW(updater.updateBatch({{GraphEvent::EDGE_ADDITION, 1, 2},
+                                      {GraphEvent::EDGE_ADDITION, 1, 0}}),
+                 std::runtime_error);
+    EXPECT_THROW(updater.updateBatch({{GraphEvent::EDGE_REMOVAL, 1, 2}}), std::runtime_error);
+    EXPECT_THROW(updater.updateBatch({{GraphEvent::EDGE_WEIGHT_UPDATE, 0, 1, 2.0}}),
+                 std::runtime_error);
+
+    // rejected batches leave the graph untouched
+    EXPECT_EQ(G.numberOfEdges(), 1);
+    EXPECT_FALSE(G.hasEdge(1, 2));
+}
+
 } /* namespace NetworKit */
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <numeric>
@@ -820,6 +821,39 @@ TEST_F(GeneratorsGTest, testChungLuGeneratorVolumeConsistency) {
     EXPECT_NEAR(G.numberOfEdges() * 2, expectedVolume, 0.2 * expectedVolume);
 }
 
+TEST_F(GeneratorsGTest, testChungLuGeneratorForEdgesParallel) {
+    const count n = 2000;
+    std::vector<count> vec(n);
+    count expectedVolume = 0;
+    for (index i = 0; i < n; ++i) {
+        vec[i] = Aux::Random::integer(1, n / 10);
+        expectedVolume += vec[i];
+    }
+    ChungLuGenerator generator(vec);
+
+    // stream the edges into per-thread buffers
+    std::vector<std::vector<std::pair<node, node>>> edgesPerThread(omp_get_max_threads());
+    const count numEdges = generator.forEdgesParallel(
+        [&](unsigned tid, node u, node v) { edgesPerThread[tid].emplace_back(u, v); });
+
+    std::vector<std::pair<node, node>> edges;
+    for (const auto &threadEdges : edgesPerThread)
+        edges.insert(edges.end(), threadEdges.begin(), threadEdges.end());
+    EXPECT_EQ(numEdges, edges.size());
+    EXPECT_NEAR(2 * numEdges, expectedVolume, 0.2 * expectedVolume);
+
+    for (const auto &edge : edges) {
+        EXPECT_LT(edge.first, edge.second);
+        EXPECT_LT(edge.second, n);
+    }
+    std::sort(edges.begin(), edges.end());
+    EXPECT_EQ(std::adjacent_find(edges.begin(), edges.end()), edges.end());
+
+    count sequentialEdges = 0;
+    EXPECT_EQ(generator.forEdges([&](node, node) { ++sequentialEdges; }), sequentialEdges);
+    EXPECT_NEAR(2 * sequentialEdges, expectedVolume, 0.2 * expectedVolume);
+}
+
 TEST_F(GeneratorsGTest, testChungLuGeneratorAlamEtAl) {
     count n = 400;
     count maxDegree = n / 8;
@@ -0,0 +1,167 @@
+/*
+ * BinaryEventStreamReader.cpp
+ */
+
+#include <atomic>
+#include <cstring>
+
+#include <networkit/io/BinaryEventStreamReader.hpp>
+#include <networkit/io/NetworkitBinaryGraph.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Decodes the varint at it into value and advances it, unless the varint exceeds end.
+bool readVarInt(const uint8_t *&it, const uint8_t *end, uint64_t &value) {
+    if (it == end)
+        return false;
+    const size_t size = *it ? tlx::ffs(*it) : 9;
+    if (static_cast<size_t>(end - it) < size)
+        return false;
+    it += nkbg::varIntDecode(it, value);
+    return true;
+}
+
+} // namespace
+
+BinaryEventStreamReader::BinaryEventStreamReader(const std::string &path) {
+    open(path);
+}
+
+void BinaryEventStreamReader::open(const std::string &path) {
+    file.open(path);
+    buffer.clear();
+    begin = reinterpret_cast<const uint8_t *>(file.cbegin());
+    end = reinterpret_cast<const uint8_t *>(file.cend());
+    readHeader();
+}
+
+void BinaryEventStreamReader::openBuffer(const std::vector<uint8_t> &data) {
+    file.close();
+    buffer = data;
+    begin = buffer.data();
+    end = buffer.data() + buffer.size();
+    readHeader();
+}
+
+void BinaryEventStreamReader::readHeader() {
+    nextChunk = 0;
+    const uint64_t headerSize = 3 * sizeof(uint64_t);
+    if (static_cast<uint64_t>(end - begin) < headerSize)
+        throw std::runtime_error("Error: binary event stream is truncated");
+
+    const uint8_t *it = begin;
+    memcpy(&header.magic, it, 8);
+    it += 8;
+    if (memcmp(nkbes::MAGIC, header.magic, 8))
+        throw std::runtime_error("Reader expected another magic value");
+    memcpy(&header.events, it, sizeof(uint64_t));
+    it += sizeof(uint64_t);
+    memcpy(&header.chunks, it, sizeof(uint64_t));
+    it += sizeof(uint64_t);
+
+    if (header.chunks > static_cast<uint64_t>(end - it) / (2 * sizeof(uint64_t)))
+        throw std::runtime_error("Error: binary event stream is truncated");
+
+    // every event takes at least one byte, and every event belongs to a chunk
+    const uint64_t tableEnd = headerSize + header.chunks * 2 * sizeof(uint64_t);
+    if (header.events > static_cast<uint64_t>(end - begin) - tableEnd
+        || (header.events > 0) != (header.chunks > 0))
+        throw std::runtime_error("Error: corrupt header in binary event stream");
+
+    chunks.resize(header.chunks);
+    for (index c = 0; c < chunks.size(); ++c) {
+        auto &chunk = chunks[c];
+        memcpy(&chunk.offset, it, sizeof(uint64_t));
+        it += sizeof(uint64_t);
+        memcpy(&chunk.firstEvent, it, sizeof(uint64_t));
+        it += sizeof(uint64_t);
+
+        // the chunks cover the events in order and are not empty
+        const bool validFirstEvent =
+            c == 0 ? chunk.firstEvent == 0
+                   : chunk.firstEvent > chunks[c - 1].firstEvent
+                         && chunk.firstEvent < header.events;
+        if (!validFirstEvent || chunk.offset < tableEnd
+            || chunk.offset > static_cast<uint64_t>(end - begin))
+            throw std::runtime_error("Error: corrupt chunk table in binary event stream");
+    }
+}
+
+count BinaryEventStreamReader::chunkSize(index chunk) const {
+    const uint64_t next =
+        (chunk + 1 < chunks.size()) ? chunks[chunk + 1].firstEvent : header.events;
+    return next - chunks[chunk].firstEvent;
+}
+
+bool BinaryEventStreamReader::decodeChunk(index chunk, GraphEvent *out) const {
+    const uint8_t *it = begin + chunks[chunk].offset;
+    const count size = chunkSize(chunk);
+    node prevU = 0;
+
+    for (index i = 0; i < size; ++i) {
+        GraphEvent &ev = out[i];
+        if (it == end)
+            return false;
+        const uint8_t tag = *it++;
+        ev.type = static_cast<GraphEvent::Type>(tag & nkbes::TYPE_MASK);
+        ev.u = none;
+        ev.v = none;
+        ev.w = defaultEdgeWeight;
+
+        uint64_t delta;
+        if (tag & nkbes::HAS_U) {
+            if (!readVarInt(it, end, delta))
+                return false;
+            ev.u = static_cast<node>(static_cast<int64_t>(prevU) + nkbg::zigzagDecode(delta));
+            prevU = ev.u;
+        }
+        if (tag & nkbes::HAS_V) {
+            if (!readVarInt(it, end, delta))
+                return false;
+            ev.v = static_cast<node>(static_cast<int64_t>(prevU) + nkbg::zigzagDecode(delta));
+        }
+        if (tag & nkbes::HAS_W) {
+            if (static_cast<size_t>(end - it) < sizeof(double))
+                return false;
+            memcpy(&ev.w, it, sizeof(double));
+            it += sizeof(double);
+        }
+    }
+
+    return true;
+}
+
+std::vector<GraphEvent> BinaryEventStreamReader::read() const {
+    std::vector<GraphEvent> stream(header.events);
+    std::atomic<bool> truncated{false};
+#pragma omp parallel for schedule(dynamic)
+    for (omp_index c = 0; c < static_cast<omp_index>(chunks.size()); ++c)
+        if (!decodeChunk(c, stream.data() + chunks[c].firstEvent))
+            truncated.store(true, std::memory_order_relaxed);
+    if (truncated)
+        throw std::runtime_error("Error: binary event stream is truncated");
+    return stream;
+}
+
+bool BinaryEventStreamReader::nextBatch(std::vector<GraphEvent> &batch) {
+    if (nextChunk >= chunks.size())
+        return false;
+    batch.resize(chunkSize(nextChunk));
+    if (!decodeChunk(nextChunk++, batch.data()))
+        throw std::runtime_error("Error: binary event stream is truncated");
+    return true;
+}
+
+count BinaryEventStreamReader::updateBatches(DynAlgorithm &algo) {
+    std::vector<GraphEvent> batch;
+    count batches = 0;
+    while (nextBatch(batch)) {
+        algo.updateBatch(batch);
+        ++batches;
+    }
+    return batches;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,121 @@
+/*
+ * BinaryEventStreamWriter.cpp
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <networkit/dynamics/DGSStreamParser.hpp>
+#include <networkit/io/BinaryEventStream.hpp>
+#include <networkit/io/BinaryEventStreamWriter.hpp>
+#include <networkit/io/NetworkitBinaryGraph.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Appends the encoding of the events [first, last) to out. Node ids are delta-encoded relative
+// to the previous event of the same chunk, so every chunk can be decoded on its own.
+void encodeChunk(const GraphEvent *first, const GraphEvent *last, std::vector<uint8_t> &out) {
+    out.resize(static_cast<size_t>(last - first) * nkbes::MAX_EVENT_SIZE);
+    uint8_t *it = out.data();
+    node prevU = 0;
+
+    for (; first != last; ++first) {
+        const GraphEvent &ev = *first;
+        uint8_t tag = static_cast<uint8_t>(ev.type) & nkbes::TYPE_MASK;
+        if (ev.u != none)
+            tag |= nkbes::HAS_U;
+        if (ev.v != none)
+            tag |= nkbes::HAS_V;
+        if (ev.w != defaultEdgeWeight)
+            tag |= nkbes::HAS_W;
+        *it++ = tag;
+
+        if (ev.u != none) {
+            it += nkbg::varIntEncode(
+                nkbg::zigzagEncode(static_cast<int64_t>(ev.u) - static_cast<int64_t>(prevU)), it);
+            prevU = ev.u;
+        }
+        if (ev.v != none) {
+            const node ref = (ev.u != none) ? ev.u : prevU;
+            it += nkbg::varIntEncode(
+                nkbg::zigzagEncode(static_cast<int64_t>(ev.v) - static_cast<int64_t>(ref)), it);
+        }
+        if (ev.w != defaultEdgeWeight) {
+            memcpy(it, &ev.w, sizeof(double));
+            it += sizeof(double);
+        }
+    }
+
+    out.resize(static_cast<size_t>(it - out.data()));
+}
+
+} // namespace
+
+BinaryEventStreamWriter::BinaryEventStreamWriter(count eventsPerChunk)
+    : eventsPerChunk(eventsPerChunk) {
+    if (!eventsPerChunk)
+        throw std::runtime_error("Error: chunks must contain at least one event");
+}
+
+void BinaryEventStreamWriter::write(const std::vector<GraphEvent> &stream,
+                                    const std::string &path) {
+    std::ofstream outfile(path, std::ios::binary);
+    if (!outfile)
+        throw std::runtime_error("Error: cannot open " + path);
+    writeData(outfile, stream);
+}
+
+std::vector<uint8_t> BinaryEventStreamWriter::writeToBuffer(const std::vector<GraphEvent> &stream) {
+    std::stringstream stream_buffer;
+    writeData(stream_buffer, stream);
+    const std::string data = stream_buffer.str();
+    return std::vector<uint8_t>(data.begin(), data.end());
+}
+
+void BinaryEventStreamWriter::convertDGS(const std::string &dgsPath, const std::string &path,
+                                         bool mapped, node baseIndex) {
+    DGSStreamParser parser(dgsPath, mapped, baseIndex);
+    write(parser.getStream(), path);
+}
+
+template <class T>
+void BinaryEventStreamWriter::writeData(T &outStream, const std::vector<GraphEvent> &stream) {
+    const count numChunks = (stream.size() + eventsPerChunk - 1) / eventsPerChunk;
+
+    std::vector<std::vector<uint8_t>> encoded(numChunks);
+#pragma omp parallel for schedule(dynamic)
+    for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+        const index first = static_cast<index>(c) * eventsPerChunk;
+        const index last = std::min<index>(first + eventsPerChunk, stream.size());
+        encodeChunk(stream.data() + first, stream.data() + last, encoded[c]);
+    }
+
+    nkbes::Header header;
+    memcpy(header.magic, nkbes::MAGIC, 8);
+    header.events = stream.size();
+    header.chunks = numChunks;
+
+    std::vector<nkbes::ChunkInfo> chunks(numChunks);
+    uint64_t offset = 3 * sizeof(uint64_t) + numChunks * 2 * sizeof(uint64_t);
+    for (index c = 0; c < numChunks; ++c) {
+        chunks[c].offset = offset;
+        chunks[c].firstEvent = c * eventsPerChunk;
+        offset += encoded[c].size();
+    }
+
+    outStream.write(header.magic, 8);
+    outStream.write(reinterpret_cast<const char *>(&header.events), sizeof(uint64_t));
+    outStream.write(reinterpret_cast<const char *>(&header.chunks), sizeof(uint64_t));
+    for (const auto &chunk : chunks) {
+        outStream.write(reinterpret_cast<const char *>(&chunk.offset), sizeof(uint64_t));
+        outStream.write(reinterpret_cast<const char *>(&chunk.firstEvent), sizeof(uint64_t));
+    }
+    for (const auto &data : encoded)
+        outStream.write(reinterpret_cast<const char *>(data.data()), data.size());
+}
+
+} // namespace NetworKit
@@ -21,6 +21,8 @@
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
 #include <networkit/io/BinaryEdgeListPartitionReader.hpp>
 #include <networkit/io/BinaryEdgeListPartitionWriter.hpp>
+#include <networkit/io/BinaryEventStreamReader.hpp>
+#include <networkit/io/BinaryEventStreamWriter.hpp>
 #include <networkit/io/BinaryPartitionReader.hpp>
 #include <networkit/io/BinaryPartitionWriter.hpp>
 #include <networkit/io/CoverReader.hpp>
@@ -52,11 +54,14 @@
 #include <networkit/io/ThrillGraphBinaryWriter.hpp>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
 #include <networkit/community/GraphClusteringTools.hpp>
 #include <networkit/community/Modularity.hpp>
 #include <networkit/community/PLP.hpp>
+#include <networkit/dynamics/DGSStreamParser.hpp>
 #include <networkit/dynamics/GraphDifference.hpp>
+#include <networkit/dynamics/GraphUpdater.hpp>
 #include <networkit/structures/Partition.hpp>
 
 #include <tlx/unused.hpp>
@@ -1310,4 +1315,114 @@ TEST_F(IOGTest, testMatrixMarketReaderIntegerWeights) {
     EXPECT_EQ(csr(21, 21), 6.0);
 }
 
+TEST_F(IOGTest, testBinaryEventStream) {
+    Aux::Random::setSeed(42, false);
+    std::vector<GraphEvent> stream;
+    for (count i = 0; i < 10000; ++i) {
+        const node u = Aux::Random::index(1000000);
+        switch (Aux::Random::integer(4)) {
+        case 0:
+            stream.emplace_back(GraphEvent::NODE_ADDITION);
+            break;
+        case 1:
+            stream.emplace_back(GraphEvent::NODE_REMOVAL, u);
+            break;
+        case 2:
+            stream.emplace_back(GraphEvent::EDGE_ADDITION, u, Aux::Random::index(1000000));
+            break;
+        case 3:
+            stream.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, u, u / 2,
+                                Aux::Random::real(-1, 1));
+            break;
+        default:
+            stream.emplace_back(GraphEvent::TIME_STEP);
+        }
+    }
+
+    for (const count eventsPerChunk : {1, 7, 1000, 100000}) {
+        BinaryEventStreamWriter writer(eventsPerChunk);
+        BinaryEventStreamReader reader;
+        reader.openBuffer(writer.writeToBuffer(stream));
+        EXPECT_EQ(reader.numberOfEvents(), stream.size());
+        EXPECT_EQ(reader.numberOfChunks(), (stream.size() + eventsPerChunk - 1) / eventsPerChunk);
+        EXPECT_EQ(reader.read(), stream);
+
+        std::vector<GraphEvent> streamed, batch;
+        while (reader.nextBatch(batch)) {
+            EXPECT_LE(batch.size(), eventsPerChunk);
+            streamed.insert(streamed.end(), batch.begin(), batch.end());
+        }
+        EXPECT_EQ(streamed, stream);
+    }
+}
+
+TEST_F(IOGTest, testBinaryEventStreamCorrupt) {
+    std::vector<GraphEvent> stream;
+    for (node u = 0; u < 100; ++u)
+        stream.emplace_back(GraphEvent::EDGE_WEIGHT_UPDATE, u, u + 1000, 0.5);
+    const std::vector<uint8_t> data = BinaryEventStreamWriter(10).writeToBuffer(stream);
+    BinaryEventStreamReader reader;
+
+    const auto setWord = [](std::vector<uint8_t> &buffer, index position, uint64_t value) {
+        std::memcpy(buffer.data() + position, &value, sizeof(uint64_t));
+    };
+    // the header consists of 3 words, followed by (offset, firstEvent) per chunk
+    const auto firstEventPosition = [](index chunk) { return (3 + 2 * chunk + 1) * 8; };
+
+    std::vector<uint8_t> corrupt = data;
+    setWord(corrupt, 2 * 8, uint64_t{1} << 61);
+    EXPECT_THROW(reader.openBuffer(corrupt), std::runtime_error);
+
+    corrupt = data;
+    setWord(corrupt, firstEventPosition(0), 1);
+    EXPECT_THROW(reader.openBuffer(corrupt), std::runtime_error);
+
+    corrupt = data;
+    setWord(corrupt, firstEventPosition(3), 15);
+    EXPECT_THROW(reader.openBuffer(corrupt), std::runtime_error);
+
+    corrupt = data;
+    setWord(corrupt, firstEventPosition(9), 100);
+    EXPECT_THROW(reader.openBuffer(corrupt), std::runtime_error);
+
+    // the chunk table is intact, but the events of the last chunk are cut off
+    corrupt.assign(data.begin(), data.end() - 5);
+    reader.openBuffer(corrupt);
+    EXPECT_THROW(reader.read(), std::runtime_error);
+    std::vector<GraphEvent> batch;
+    for (count c = 0; c < 9; ++c)
+        EXPECT_TRUE(reader.nextBatch(batch));
+    EXPECT_THROW(reader.nextBatch(batch), std::runtime_error);
+}
+
+TEST_F(IOGTest, testBinaryEventStreamFromDGS) {
+    const std::string path = "output/example2.nkbes";
+    BinaryEventStreamWriter(4).convertDGS("input/example2.dgs", path);
+
+    BinaryEventStreamReader reader(path);
+    EXPECT_EQ(reader.read(), DGSStreamParser("input/example2.dgs").getStream());
+
+    // feed the batches to a dynamic algorithm
+    struct EventCounter final : public DynAlgorithm {
+        count batches = 0, events = 0;
+        void update(GraphEvent) override { ++events; }
+        void updateBatch(const std::vector<GraphEvent> &batch) override {
+            ++batches;
+            events += batch.size();
+        }
+    } counter;
+    EXPECT_EQ(reader.updateBatches(counter), 4);
+    EXPECT_EQ(counter.batches, 4);
+    EXPECT_EQ(counter.events, 16);
+
+    reader.rewind();
+    Graph G(0, true);
+    GraphUpdater updater(G);
+    std::vector<GraphEvent> batch;
+    while (reader.nextBatch(batch))
+        updater.update(batch);
+    EXPECT_EQ(G.numberOfNodes(), 4);
+    EXPECT_EQ(G.numberOfEdges(), 2);
+}
+
 } /* namespace NetworKit */
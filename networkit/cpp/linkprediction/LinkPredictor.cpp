@@ -6,6 +6,7 @@
  */
 
 #include <algorithm>
+#include <numeric>
 
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/Parallel.hpp>
@@ -62,4 +63,79 @@ std::vector<LinkPredictor::prediction> LinkPredictor::runAll() {
     return runOn(nodePairs);
 }
 
+std::vector<LinkPredictor::prediction> LinkPredictor::runTopK(count k, count batchSize) {
+    if (G == nullptr) {
+        throw std::logic_error("Set a graph first.");
+    } else if (G->isDirected()) {
+        throw std::invalid_argument("Only undirected graphs accepted.");
+    }
+
+    const auto higherScore = [](const prediction &a, const prediction &b) {
+        return a.second > b.second || (a.second == b.second && a.first < b.first);
+    };
+
+    std::vector<prediction> top;
+    if (k == 0)
+        return top;
+
+    const std::vector<node> nodes(G->nodeRange().begin(), G->nodeRange().end());
+    // lastSeen[v] == u if v is u, a neighbor of u or an already enumerated candidate of u
+    std::vector<std::vector<node>> lastSeen(omp_get_max_threads());
+
+    // wedgesBefore[i] is the number of wedges centered at the neighbors of nodes[0..i-1]
+    std::vector<count> wedgesBefore(nodes.size() + 1, 0);
+#pragma omp parallel for schedule(dynamic, 64)
+    for (omp_index i = 0; i < static_cast<omp_index>(nodes.size()); ++i)
+        G->forNeighborsOf(nodes[i], [&](node w) { wedgesBefore[i + 1] += G->degree(w); });
+    std::partial_sum(wedgesBefore.begin(), wedgesBefore.end(), wedgesBefore.begin());
+
+    for (index first = 0; first < nodes.size();) {
+        // the batch ends once the number of wedges of its nodes reaches batchSize
+        const index last = std::min<index>(
+            std::lower_bound(wedgesBefore.begin() + first + 1, wedgesBefore.end(),
+                             wedgesBefore[first] + batchSize)
+                - wedgesBefore.begin(),
+            nodes.size());
+
+        std::vector<std::pair<node, node>> candidates;
+#pragma omp parallel
+        {
+            auto &seen = lastSeen[omp_get_thread_num()];
+            seen.resize(G->upperNodeIdBound(), none);
+            std::vector<std::pair<node, node>> candidatesPrivate;
+#pragma omp for schedule(dynamic) nowait
+            for (omp_index i = static_cast<omp_index>(first); i < static_cast<omp_index>(last);
+                 ++i) {
+                const node u = nodes[i];
+                seen[u] = u;
+                G->forNeighborsOf(u, [&](node w) { seen[w] = u; });
+                G->forNeighborsOf(u, [&](node w) {
+                    G->forNeighborsOf(w, [&](node v) {
+                        if (v > u && seen[v] != u) {
+                            seen[v] = u;
+                            candidatesPrivate.emplace_back(u, v);
+                        }
+                    });
+                });
+            }
+#pragma omp critical
+            candidates.insert(candidates.end(), candidatesPrivate.begin(),
+                              candidatesPrivate.end());
+        }
+        first = last;
+
+        if (candidates.empty())
+            continue;
+        const std::vector<prediction> predictions = runOn(std::move(candidates));
+        top.insert(top.end(), predictions.begin(), predictions.end());
+        if (top.size() > k) {
+            std::nth_element(top.begin(), top.begin() + k, top.end(), higherScore);
+            top.resize(k);
+        }
+    }
+
+    std::sort(top.begin(), top.end(), higherScore);
+    return top;
+}
+
 } // namespace NetworKit
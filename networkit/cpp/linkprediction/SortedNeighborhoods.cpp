@@ -0,0 +1,69 @@
+/*
+ * SortedNeighborhoods.cpp
+ *
+ * Sorted adjacency snapshot shared by the neighborhood-based link predictors.
+ */
+
+#include <networkit/linkprediction/SortedNeighborhoods.hpp>
+
+namespace NetworKit {
+
+SortedNeighborhoods::SortedNeighborhoods(const Graph &G) {
+    const count z = G.upperNodeIdBound();
+    offsets.assign(z + 1, 0);
+    G.parallelForNodes([&](node u) { offsets[u + 1] = G.degree(u); });
+    for (index u = 0; u < z; ++u)
+        offsets[u + 1] += offsets[u];
+
+    neighbors.resize(offsets[z]);
+    G.balancedParallelForNodes([&](node u) {
+        index pos = offsets[u];
+        G.forNeighborsOf(u, [&](node v) { neighbors[pos++] = v; });
+        std::sort(neighbors.begin() + offsets[u], neighbors.begin() + offsets[u + 1]);
+    });
+}
+
+void NeighborhoodPredictor::setGraph(const Graph &newGraph) {
+    LinkPredictor::setGraph(newGraph);
+    neighborhoods = SortedNeighborhoods();
+    snapshotTaken = std::make_unique<std::once_flag>();
+}
+
+std::vector<LinkPredictor::prediction>
+NeighborhoodPredictor::runOn(std::vector<std::pair<node, node>> nodePairs) {
+    if (G == nullptr)
+        throw std::logic_error("Set a graph first.");
+    // take the snapshot before run() is called concurrently
+    if (!keepSnapshot)
+        takeSnapshot();
+    return LinkPredictor::runOn(std::move(nodePairs));
+}
+
+std::vector<LinkPredictor::prediction> NeighborhoodPredictor::runTopK(count k, count batchSize) {
+    if (G == nullptr)
+        throw std::logic_error("Set a graph first.");
+    takeSnapshot();
+    keepSnapshot = true;
+    std::vector<prediction> top;
+    try {
+        top = LinkPredictor::runTopK(k, batchSize);
+    } catch (...) {
+        keepSnapshot = false;
+        throw;
+    }
+    keepSnapshot = false;
+    return top;
+}
+
+const SortedNeighborhoods &NeighborhoodPredictor::sortedNeighborhoods() {
+    std::call_once(*snapshotTaken, [&] { neighborhoods = SortedNeighborhoods(*G); });
+    return neighborhoods;
+}
+
+void NeighborhoodPredictor::takeSnapshot() {
+    neighborhoods = SortedNeighborhoods(*G);
+    snapshotTaken = std::make_unique<std::once_flag>();
+    std::call_once(*snapshotTaken, [] {});
+}
+
+} // namespace NetworKit
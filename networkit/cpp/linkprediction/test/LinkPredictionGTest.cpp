@@ -9,6 +9,8 @@
 
 #include <chrono>
 
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
 #include <networkit/graph/Graph.hpp>
 
 #include <networkit/io/METISGraphReader.hpp>
@@ -20,6 +22,7 @@
 #include <networkit/linkprediction/LinkPredictor.hpp>
 #include <networkit/linkprediction/LinkThresholder.hpp>
 #include <networkit/linkprediction/MissingLinksFinder.hpp>
+#include <networkit/linkprediction/NeighborhoodUtility.hpp>
 #include <networkit/linkprediction/NeighborsMeasureIndex.hpp>
 #include <networkit/linkprediction/PrecisionRecallMetric.hpp>
 #include <networkit/linkprediction/PredictionsSorter.hpp>
@@ -27,6 +30,7 @@
 #include <networkit/linkprediction/RandomLinkSampler.hpp>
 #include <networkit/linkprediction/ResourceAllocationIndex.hpp>
 #include <networkit/linkprediction/SameCommunityIndex.hpp>
+#include <networkit/linkprediction/SortedNeighborhoods.hpp>
 #include <networkit/linkprediction/TotalNeighborsIndex.hpp>
 #include <networkit/linkprediction/UDegreeIndex.hpp>
 #include <networkit/linkprediction/VDegreeIndex.hpp>
@@ -88,6 +92,81 @@ TEST_F(LinkPredictionGTest, testCommonNeighborsIndexRunOn) {
     EXPECT_EQ(1, predictions[5].second);
 }
 
+TEST_F(LinkPredictionGTest, testCommonNeighborsIndexRunOnModifiedGraph) {
+    Graph G = trainingGraph;
+    CommonNeighborsIndex cn(G);
+    EXPECT_EQ(cn.runOn({{2, 4}}).front().second, 3);
+
+    // runOn() has to reflect changes of the graph made after the previous call
+    G.removeEdge(2, 3);
+    EXPECT_EQ(cn.runOn({{2, 4}}).front().second, 2);
+    EXPECT_EQ(cn.runTopK(1).front().second, 2);
+}
+
+TEST_F(LinkPredictionGTest, testSortedNeighborhoods) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.02).generate();
+    // hubs make the neighborhood sizes differ enough for galloping
+    for (node hub : {0, 1}) {
+        G.forNodes([&](node v) {
+            if (v > 1 && Aux::Random::probability() < 0.8 && !G.hasEdge(hub, v))
+                G.addEdge(hub, v);
+        });
+    }
+    G.removeNode(17);
+
+    const SortedNeighborhoods neighborhoods(G);
+    JaccardIndex jaccard(G);
+    ResourceAllocationIndex resourceAllocation(G);
+    G.forNodes([&](node u) {
+        EXPECT_EQ(neighborhoods.degree(u), G.degree(u));
+        G.forNodes([&](node v) {
+            const auto common = NeighborhoodUtility::getCommonNeighbors(G, u, v);
+            const auto neighborsUnion = NeighborhoodUtility::getNeighborsUnion(G, u, v);
+
+            std::vector<node> found;
+            neighborhoods.forCommonNeighbors(u, v, [&](node w) { found.push_back(w); });
+            EXPECT_EQ(found, common);
+            EXPECT_EQ(neighborhoods.numberOfCommonNeighbors(u, v), common.size());
+            EXPECT_EQ(neighborhoods.neighborsUnionSize(u, v), neighborsUnion.size());
+
+            if (u == v)
+                return;
+            const double expectedJaccard =
+                neighborsUnion.empty() ? 0 : 1.0 * common.size() / neighborsUnion.size();
+            EXPECT_DOUBLE_EQ(jaccard.run(u, v), expectedJaccard);
+            double expectedResourceAllocation = 0;
+            for (const node w : common)
+                expectedResourceAllocation += 1.0 / G.degree(w);
+            EXPECT_DOUBLE_EQ(resourceAllocation.run(u, v), expectedResourceAllocation);
+        });
+    });
+}
+
+TEST_F(LinkPredictionGTest, testRunTopK) {
+    const Graph G = METISGraphReader{}.read("input/jazz.graph");
+    const auto higherScore = [](const LinkPredictor::prediction &a,
+                                const LinkPredictor::prediction &b) {
+        return a.second > b.second || (a.second == b.second && a.first < b.first);
+    };
+
+    AdamicAdarIndex predictor(G);
+    auto expected = predictor.runOn(MissingLinksFinder(G).findAtDistance(2));
+    std::sort(expected.begin(), expected.end(), higherScore);
+
+    for (const count k : {1, 50, 1000000}) {
+        // small batches force many rounds of candidate enumeration
+        for (const count batchSize : {count{100}, count{1} << 20}) {
+            const auto top = predictor.runTopK(k, batchSize);
+            ASSERT_EQ(top.size(), std::min(k, expected.size()));
+            for (index i = 0; i < top.size(); ++i) {
+                EXPECT_EQ(top[i].first, expected[i].first);
+                EXPECT_DOUBLE_EQ(top[i].second, expected[i].second);
+            }
+        }
+    }
+}
+
 TEST_F(LinkPredictionGTest, testMissingLinksFinderDistanceTwo) {
     EXPECT_EQ(6, missingLinks.size());
     EXPECT_EQ(0, missingLinks[0].first);
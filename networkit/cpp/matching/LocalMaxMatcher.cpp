@@ -4,8 +4,10 @@
  *  Created on: 05.12.2012
  */
 
+#include <algorithm>
 #include <stdexcept>
 
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/matching/LocalMaxMatcher.hpp>
 
 namespace NetworKit {
@@ -15,59 +17,75 @@ LocalMaxMatcher::LocalMaxMatcher(const Graph &G) : Matcher(G) {
         throw std::runtime_error("Matcher only defined for undirected graphs");
 }
 
-// TODO: update to new edge attribute system
-// TODO: make local max matching parallel
-
 void LocalMaxMatcher::run() {
-    count z = G->upperNodeIdBound();
-    count E = G->numberOfEdges();
+    const count z = G->upperNodeIdBound();
 
-    std::vector<WeightedEdge> edges;
-    edges.reserve(G->numberOfEdges());
-    for (auto edge : G->edgeWeightRange())
-        edges.emplace_back(edge.u, edge.v, edge.weight + Aux::Random::real(1e-6));
+    // Edges are rated by their weight; ties are broken by a random but fixed rating of the edge,
+    // computed from its endpoints so that both endpoints agree on it.
+    const uint64_t seed = Aux::Random::integer();
+    const auto tieBreaker = [seed](node u, node v) -> uint64_t {
+        uint64_t x = seed ^ (std::min(u, v) * 0x9E3779B97F4A7C15ULL)
+                     ^ (std::max(u, v) * 0xC2B2AE3D27D4EB4FULL);
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    };
+    const auto isHeavier = [&](node u, node v, edgeweight w, node x, edgeweight wx) -> bool {
+        if (w != wx)
+            return w > wx;
+        const uint64_t rv = tieBreaker(u, v), rx = tieBreaker(u, x);
+        return rv != rx ? rv > rx : v < x;
+    };
 
-    // candidates records mating candidates
-    std::vector<WeightedEdge> candidates(z);
-    G->parallelForNodes([&](node u) {
-        candidates[u].weight = (edgeweight)0;
-        candidates[u].v = u; // itself as mating partner => unmatched
-    });
+    // candidates records mating candidates, none if all neighbors are matched
+    std::vector<node> candidates(z, none);
+    std::vector<node> active;
+    active.reserve(G->numberOfNodes());
+    G->forNodes([&](node u) { active.push_back(u); });
 
-    while (E > 0) {
-        // for each edge find out if it is locally maximum
-        for (const auto &edge : edges) {
-            if (edge.weight > candidates[edge.u].weight
-                && edge.weight > candidates[edge.v].weight) {
-                candidates[edge.u].v = edge.v;
-                candidates[edge.u].weight = edge.weight;
-                candidates[edge.v].v = edge.u;
-                candidates[edge.v].weight = edge.weight;
-            }
+    while (!active.empty()) {
+        // every active node picks its heaviest edge to an unmatched neighbor
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+            const node u = active[i];
+            node best = none;
+            edgeweight bestWeight = 0;
+            G->forNeighborsOf(u, [&](node v, edgeweight w) {
+                if (v == u || M.isMatched(v))
+                    return;
+                if (best == none || isHeavier(u, v, w, best, bestWeight)) {
+                    best = v;
+                    bestWeight = w;
+                }
+            });
+            candidates[u] = best;
         }
 
-        // check if candidates agree to match; if so, then match them
-        for (const auto &edge : edges) {
-            node u = edge.u;
-            node v = edge.v;
-            if (candidates[u].v == v && candidates[v].v == u && u != v) {
-                // both nodes agree
+        // locally dominant edges are chosen by both endpoints; match them
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+            const node u = active[i];
+            const node v = candidates[u];
+            if (v != none && u < v && candidates[v] == u)
                 M.match(u, v);
-            }
         }
 
-        // create remaining "graph" by selecting remaining edges (as triples)
-        // adjust candidates
-        std::vector<WeightedEdge> newEdges;
-        for (const auto &edge : edges) {
-            if (!M.isMatched(edge.u) && !M.isMatched(edge.v) && edge.u != edge.v) {
-                newEdges.push_back(edge);
-                candidates[edge.u].weight = (edgeweight)0;
-                candidates[edge.v].weight = (edgeweight)0;
+        // nodes stay active while they are unmatched and have unmatched neighbors
+        std::vector<node> stillActive;
+#pragma omp parallel
+        {
+            std::vector<node> stillActivePrivate;
+#pragma omp for nowait
+            for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+                const node u = active[i];
+                if (!M.isMatched(u) && candidates[u] != none)
+                    stillActivePrivate.push_back(u);
             }
+#pragma omp critical
+            stillActive.insert(stillActive.end(), stillActivePrivate.begin(),
+                               stillActivePrivate.end());
         }
-        edges = newEdges;
-        E = edges.size();
+        active.swap(stillActive);
     }
 
     hasRun = true;
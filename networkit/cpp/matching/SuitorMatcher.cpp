@@ -12,6 +12,8 @@
 
 #include <networkit/matching/SuitorMatcher.hpp>
 
+#include <omp.h>
+
 namespace NetworKit {
 
 SuitorMatcher::SuitorMatcher(const Graph &G, bool sortSuitor, bool checkSortedEdges)
@@ -52,51 +54,75 @@ bool SuitorMatcher::hasEdgesSortedByWeight(const Graph &G) {
     return isSorted.load(std::memory_order_relaxed);
 }
 
-void SuitorMatcher::findSuitor(node current) {
-    bool done = false;
-
-    do {
+bool SuitorMatcher::isBetterSuitor(node current, node v, edgeweight weight) const {
+    edgeweight weightOfSuitor;
+    node suitorOfV;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic read
+#endif // NETWORKIT_OMP2
+    weightOfSuitor = ws[v];
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic read
+#endif // NETWORKIT_OMP2
+    suitorOfV = suitor[v];
+    return weight > weightOfSuitor || (weight == weightOfSuitor && current < suitorOfV);
+}
 
-        node partner = suitor[current];
-        edgeweight heaviest = ws[current];
+bool SuitorMatcher::propose(node current, node partner, edgeweight weight, node &displaced) {
+    Aux::Spinlock &lock = locks[partner];
+    lock.lock();
+    // the suitor of partner may have changed since current has chosen it
+    const node y = suitor[partner];
+    const bool accepted = weight > ws[partner] || (weight == ws[partner] && current < y);
+    if (accepted) {
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic write
+#endif // NETWORKIT_OMP2
+        suitor[partner] = current;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic write
+#endif // NETWORKIT_OMP2
+        ws[partner] = weight;
+    }
+    lock.unlock();
+
+    if (accepted)
+        displaced = y;
+    return accepted;
+}
 
+void SuitorMatcher::findSuitor(node current) {
+    while (current != none) {
+        node partner = none;
+        edgeweight heaviest = 0;
         G->forNeighborsOf(current, [&](const node v, const edgeweight weight) {
-            if ((weight > heaviest || (weight == heaviest && v < partner))
-                && (weight > ws[v] || (weight == ws[v] && current < suitor[v]))) {
+            if (partner != none && (weight < heaviest || (weight == heaviest && v > partner)))
+                return;
+            if (isBetterSuitor(current, v, weight)) {
                 partner = v;
                 heaviest = weight;
             }
         });
 
-        done = true;
-
-        if (partner != none
-            && (heaviest > ws[partner] || (heaviest == ws[partner] && current < suitor[partner]))) {
-            node y = suitor[partner];
-            suitor[partner] = current;
-            ws[partner] = heaviest;
-
-            // if the current vertex already has a suitor
-            if (y != none) {
-                current = y;
-                done = false;
-            }
-        }
-    } while (!done);
+        if (partner == none)
+            return;
+        // if the proposal fails, the suitor of partner has changed: search again
+        node displaced;
+        if (propose(current, partner, heaviest, displaced))
+            current = displaced;
+    }
 }
 
 void SuitorMatcher::findSortSuitor(node current) {
-    bool done = false;
-
-    do {
-        node partner = suitor[current];
-        edgeweight heaviest = ws[current];
-
+    while (current != none) {
+        node partner = none;
+        edgeweight heaviest = 0;
+        // Neighbors that are skipped cannot become eligible again, since the weights of the
+        // suitors only increase.
         for (index &iter = neighborIterators[current]; iter < G->degree(current); ++iter) {
             const node v = G->getIthNeighbor(current, iter);
             const edgeweight weight = G->getIthNeighborWeight(current, iter);
-            if ((weight > heaviest || (weight == heaviest && v < partner))
-                && (weight > ws[v] || (weight == ws[v] && current < suitor[v]))) {
+            if (isBetterSuitor(current, v, weight)) {
                 partner = v;
                 heaviest = weight;
                 ++iter;
@@ -104,21 +130,12 @@ void SuitorMatcher::findSortSuitor(node current) {
             }
         }
 
-        done = true;
-
-        if (partner != none
-            && (heaviest > ws[partner] || (heaviest == ws[partner] && current < suitor[partner]))) {
-            const node y = suitor[partner];
-            suitor[partner] = current;
-            ws[partner] = heaviest;
-
-            // if the current vertex already has a suitor
-            if (y != none) {
-                current = y;
-                done = false;
-            }
-        }
-    } while (!done);
+        if (partner == none)
+            return;
+        node displaced;
+        if (propose(current, partner, heaviest, displaced))
+            current = displaced;
+    }
 }
 
 void SuitorMatcher::run() {
@@ -126,13 +143,24 @@ void SuitorMatcher::run() {
     suitor.assign(n, none);
     ws.assign(n, 0);
 
+    locks = std::vector<Aux::Spinlock>(n);
     if (sortSuitor)
         neighborIterators.assign(n, 0);
 
-    if (sortSuitor)
-        G->forNodes([&](node u) { findSortSuitor(u); });
-    else
-        G->forNodes([&](node u) { findSuitor(u); });
+    // A node is only processed by one thread at a time: it is either processed by its own
+    // iteration, or it has been displaced by a proposal after that iteration has proposed it.
+#pragma omp parallel
+    {
+#pragma omp for schedule(dynamic, 64)
+        for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+            if (!G->hasNode(u))
+                continue;
+            if (sortSuitor)
+                findSortSuitor(u);
+            else
+                findSuitor(u);
+        }
+    }
 
     G->parallelForNodes([&suitor = suitor, &M = M](node u) {
         if (suitor[u] == none) {
@@ -6,6 +6,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <omp.h>
 
 #include <networkit/auxiliary/Random.hpp>
 #include <networkit/graph/Graph.hpp>
@@ -185,4 +186,35 @@ TEST_F(MatcherGTest, testSuitorMatcher) {
     }
 }
 
+TEST_F(MatcherGTest, testParallelMatchersAgree) {
+    Aux::Random::setSeed(42, false);
+    auto G = METISGraphReader{}.read("input/PGPgiantcompo.graph");
+    G.removeSelfLoops();
+    G.removeMultiEdges();
+    G = GraphTools::toWeighted(G);
+    G.forEdges([&G](node u, node v) { G.setWeight(u, v, Aux::Random::real()); });
+    GraphTools::sortEdgesByWeight(G, true);
+
+    const int maxThreads = omp_get_max_threads();
+    std::vector<Matching> matchings;
+    for (int threads : {1, maxThreads}) {
+        omp_set_num_threads(threads);
+
+        SuitorMatcher sm(G);
+        sm.run();
+        matchings.push_back(sm.getMatching());
+
+        LocalMaxMatcher lmm(G);
+        lmm.run();
+        matchings.push_back(lmm.getMatching());
+    }
+    omp_set_num_threads(maxThreads);
+
+    // With distinct weights, both compute the unique locally dominant matching.
+    for (const auto &M : matchings) {
+        EXPECT_TRUE(M.isProper(G));
+        G.forNodes([&](node u) { EXPECT_EQ(M.mate(u), matchings.front().mate(u)); });
+    }
+}
+
 } // namespace NetworKit
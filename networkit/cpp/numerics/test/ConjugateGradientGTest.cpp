@@ -0,0 +1,157 @@
+/*
+ * ConjugateGradientGTest.cpp
+ */
+
+#include <gtest/gtest.h>
+#include <omp.h>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/algebraic/Vector.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/numerics/ConjugateGradient.hpp>
+#include <networkit/numerics/Preconditioner/DiagonalPreconditioner.hpp>
+#include <networkit/numerics/Preconditioner/IdentityPreconditioner.hpp>
+
+namespace NetworKit {
+
+namespace {
+// Only provides the single-vector interface, so the block solver applies it column by column.
+class SingleVectorPreconditioner {
+public:
+    SingleVectorPreconditioner() = default;
+    SingleVectorPreconditioner(const CSRMatrix &A) : diagonal(A) {}
+    Vector rhs(const Vector &b) const { return diagonal.rhs(b); }
+
+private:
+    DiagonalPreconditioner diagonal;
+};
+} // namespace
+
+class ConjugateGradientGTest : public testing::Test {
+protected:
+    // Laplacian of a random graph plus the identity, which is positive definite.
+    CSRMatrix randomSPDMatrix(count n) const {
+        Aux::Random::setSeed(42, false);
+        const Graph G = ErdosRenyiGenerator(n, 0.05).generate();
+        std::vector<Triplet> triplets;
+        G.forNodes([&](node u) { triplets.push_back({u, u, 1. + G.degree(u)}); });
+        G.forEdges([&](node u, node v) {
+            triplets.push_back({u, v, -1.});
+            triplets.push_back({v, u, -1.});
+        });
+        return CSRMatrix(n, triplets);
+    }
+
+    template <class Preconditioner>
+    void checkBlockSolve(count blockSize) const {
+        const count n = 300;
+        const CSRMatrix A = randomSPDMatrix(n);
+        ConjugateGradient<CSRMatrix, Preconditioner> cg(1e-8);
+        cg.setup(A);
+
+        std::vector<Vector> rhs(11, Vector(n));
+        for (auto &b : rhs)
+            for (index i = 0; i < n; ++i)
+                b[i] = Aux::Random::real(-1., 1.);
+
+        std::vector<Vector> results(rhs.size(), Vector(n, 0.));
+        const auto stati = cg.blockSolve(rhs, results, blockSize);
+        ASSERT_EQ(stati.size(), rhs.size());
+
+        for (index r = 0; r < rhs.size(); ++r) {
+            EXPECT_TRUE(stati[r].converged);
+            EXPECT_LE((rhs[r] - A * results[r]).length(), 1e-8 * rhs[r].length() * (1 + 1e-6));
+            EXPECT_NEAR(stati[r].residual, (rhs[r] - A * results[r]).length(), 1e-12);
+
+            Vector single(n, 0.);
+            cg.solve(rhs[r], single);
+            for (index i = 0; i < n; ++i)
+                EXPECT_NEAR(single[i], results[r][i], 1e-6);
+        }
+    }
+};
+
+TEST_F(ConjugateGradientGTest, testBlockSolve) {
+    for (count blockSize : {1, 4, 8, 16})
+        checkBlockSolve<IdentityPreconditioner>(blockSize);
+}
+
+TEST_F(ConjugateGradientGTest, testBlockSolveDiagonalPreconditioner) {
+    checkBlockSolve<DiagonalPreconditioner>(
+        ConjugateGradient<CSRMatrix, DiagonalPreconditioner>::DEFAULT_BLOCK_SIZE);
+}
+
+TEST_F(ConjugateGradientGTest, testBlockSolveSingleVectorPreconditioner) {
+    checkBlockSolve<SingleVectorPreconditioner>(
+        ConjugateGradient<CSRMatrix, SingleVectorPreconditioner>::DEFAULT_BLOCK_SIZE);
+}
+
+TEST_F(ConjugateGradientGTest, testBlockSolveDeterministic) {
+    const count n = 3000;
+    const CSRMatrix A = randomSPDMatrix(n);
+    ConjugateGradient<CSRMatrix, DiagonalPreconditioner> cg(1e-10);
+    cg.setup(A);
+
+    std::vector<Vector> rhs(5, Vector(n));
+    for (auto &b : rhs)
+        for (index i = 0; i < n; ++i)
+            b[i] = Aux::Random::real(-1., 1.);
+
+    // the results must not depend on the number of threads
+    const int maxThreads = omp_get_max_threads();
+    std::vector<Vector> results(rhs.size(), Vector(n, 0.));
+    cg.blockSolve(rhs, results);
+    omp_set_num_threads(1);
+    std::vector<Vector> sequentialResults(rhs.size(), Vector(n, 0.));
+    cg.blockSolve(rhs, sequentialResults);
+    omp_set_num_threads(maxThreads);
+
+    for (index r = 0; r < rhs.size(); ++r)
+        EXPECT_EQ(results[r], sequentialResults[r]);
+}
+
+TEST_F(ConjugateGradientGTest, testZeroRHS) {
+    const count n = 100;
+    const CSRMatrix A = randomSPDMatrix(n);
+    ConjugateGradient<CSRMatrix, DiagonalPreconditioner> cg(1e-8);
+    cg.setup(A);
+
+    Vector result(n, 1.);
+    const auto status = cg.solve(Vector(n, 0.), result);
+    EXPECT_TRUE(status.converged);
+    EXPECT_EQ(status.residual, 0.);
+    EXPECT_EQ(result, Vector(n, 0.));
+
+    std::vector<Vector> rhs(2, Vector(n, 0.));
+    rhs[1][0] = 1.;
+    std::vector<Vector> results(rhs.size(), Vector(n, 1.));
+    const auto stati = cg.blockSolve(rhs, results);
+    EXPECT_TRUE(stati[0].converged);
+    EXPECT_EQ(stati[0].residual, 0.);
+    EXPECT_EQ(results[0], Vector(n, 0.));
+    EXPECT_TRUE(stati[1].converged);
+}
+
+TEST_F(ConjugateGradientGTest, testBlockSolveMaxIterations) {
+    const count n = 300;
+    const CSRMatrix A = randomSPDMatrix(n);
+    ConjugateGradient<CSRMatrix, IdentityPreconditioner> cg(1e-12);
+    cg.setup(A);
+
+    // Constant vectors are eigenvectors of the matrix and would be solved in one iteration.
+    std::vector<Vector> rhs(3, Vector(n, 0.)); // rhs[1] is trivially solved by the initial value
+    for (index i = 0; i < n; ++i) {
+        rhs[0][i] = static_cast<double>(i);
+        rhs[2][i] = static_cast<double>(i % 7);
+    }
+    std::vector<Vector> results(rhs.size(), Vector(n, 0.));
+    const auto stati = cg.blockSolve(rhs, results, 3, 5 * 60 * 1000, 2);
+
+    EXPECT_EQ(stati[0].numIters, 2u);
+    EXPECT_EQ(stati[1].numIters, 0u);
+    EXPECT_EQ(stati[2].numIters, 2u);
+    EXPECT_EQ(results[1], Vector(n, 0.));
+}
+
+} // namespace NetworKit
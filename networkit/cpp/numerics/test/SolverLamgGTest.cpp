@@ -9,6 +9,7 @@
 
 #include <networkit/algebraic/CSRMatrix.hpp>
 #include <networkit/algebraic/Vector.hpp>
+#include <networkit/auxiliary/Parallelism.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/generators/BarabasiAlbertGenerator.hpp>
@@ -80,6 +81,83 @@ TEST_F(SolverLamgGTest, testSmallGraphs) {
     }
 }
 
+TEST_F(SolverLamgGTest, testParallelEliminationSetup) {
+    METISGraphReader reader;
+    GaussSeidelRelaxation<CSRMatrix> gaussSmoother;
+    MultiLevelSetup<CSRMatrix> setup(gaussSmoother);
+    const count maxThreads = Aux::getMaxNumberOfThreads();
+    bool comparedLevels = false;
+
+    for (const auto &graph : GRAPH_INSTANCES) {
+        Graph G = reader.read(graph);
+
+        // The elimination levels do not depend on random test vectors, so they must not depend
+        // on the number of threads either.
+        Aux::setNumberOfThreads(1);
+        LevelHierarchy<CSRMatrix> sequential;
+        setup.setup(G, sequential);
+
+        Aux::setNumberOfThreads(std::max<count>(maxThreads, 4));
+        LevelHierarchy<CSRMatrix> parallel;
+        setup.setup(G, parallel);
+        Aux::setNumberOfThreads(maxThreads);
+
+        ASSERT_EQ(sequential.size() > 1, parallel.size() > 1);
+        if (sequential.size() > 1 && sequential.getType(1) == ELIMINATION) {
+            ASSERT_EQ(parallel.getType(1), ELIMINATION);
+            EXPECT_TRUE(sequential.at(1).getLaplacian() == parallel.at(1).getLaplacian());
+            comparedLevels = true;
+        }
+    }
+
+    EXPECT_TRUE(comparedLevels);
+}
+
+TEST_F(SolverLamgGTest, testSolveBlock) {
+    METISGraphReader reader;
+    GaussSeidelRelaxation<CSRMatrix> smoother;
+    MultiLevelSetup<CSRMatrix> setup(smoother);
+
+    for (const auto &graph : GRAPH_INSTANCES) {
+        Graph G = reader.read(graph);
+        ConnectedComponents con(G);
+        con.run();
+        if (con.numberOfComponents() > 1)
+            continue;
+
+        LevelHierarchy<CSRMatrix> hierarchy;
+        setup.setup(G, hierarchy);
+        const CSRMatrix &L = hierarchy.at(0).getLaplacian();
+
+        const count k = 5;
+        std::vector<Vector> b(k), x(k);
+        std::vector<LAMGSolverStatus> stati(k);
+        for (index i = 0; i < k; ++i) {
+            b[i] = randZeroSum(G, 12345 + i);
+            x[i] = randVector(G.numberOfNodes());
+            stati[i].desiredResidualReduction = 1e-6 * b[i].length() / (L * x[i] - b[i]).length();
+        }
+        // a system with a tighter tolerance stays in the block for more cycles
+        stati[2].desiredResidualReduction *= 1e-2;
+
+        std::vector<Vector> blockResults = x;
+        std::vector<LAMGSolverStatus> blockStati = stati;
+        SolverLamg<CSRMatrix>(hierarchy, smoother).solveBlock(blockResults, b, blockStati);
+
+        for (index i = 0; i < k; ++i) {
+            Vector result = x[i];
+            LAMGSolverStatus status = stati[i];
+            SolverLamg<CSRMatrix>(hierarchy, smoother).solve(result, b[i], status);
+
+            EXPECT_TRUE(blockStati[i].converged);
+            EXPECT_EQ(blockStati[i].numIters, status.numIters);
+            EXPECT_NEAR(blockStati[i].residual, status.residual, 1e-9);
+            for (index j = 0; j < G.numberOfNodes(); ++j)
+                EXPECT_NEAR(blockResults[i][j], result[j], 1e-9);
+        }
+    }
+}
+
 Vector SolverLamgGTest::randVector(count dimension) const {
     Vector randVector(dimension);
     for (index i = 0; i < dimension; ++i) {
@@ -21,6 +21,10 @@ void Curveball::run(const CurveballDetails::trade_vector &trades) {
     impl->run(trades);
 }
 
+void Curveball::setParallel(bool parallel) {
+    impl->setParallel(parallel);
+}
+
 Graph Curveball::getGraph(bool parallel) {
     return impl->getGraph(parallel);
 }
@@ -5,11 +5,14 @@
  */
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <numeric>
+#include <omp.h>
 #include <vector>
 
 #include "CurveballImpl.hpp"
 #include <tlx/algorithm/random_bipartition_shuffle.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 
@@ -380,11 +383,36 @@ void CurveballIM::restructureGraph(const std::vector<std::pair<node, node>> &tra
 }
 
 void CurveballIM::run(const trade_vector &trades) {
+    // Trading a node with itself does not change the graph. Such trades are removed before they
+    // enter the trade lists, where they would also keep runParallel from forming a batch.
+    const auto isSelfTrade = [](const trade_descriptor &trade) {
+        return trade.first == trade.second;
+    };
+    if (std::any_of(trades.begin(), trades.end(), isSelfTrade)) {
+        trade_vector otherTrades;
+        otherTrades.reserve(trades.size());
+        std::remove_copy_if(trades.begin(), trades.end(), std::back_inserter(otherTrades),
+                            isSelfTrade);
+        run(otherTrades);
+        return;
+    }
+
     if (!hasRun)
         loadFromGraph(trades);
     else
         restructureGraph(trades);
 
+    if (parallel && omp_get_max_threads() > 1)
+        runParallel(trades);
+    else
+        runSequential(trades);
+
+    hasRun = true;
+
+    return;
+}
+
+void CurveballIM::runSequential(const trade_vector &trades) {
     neighbour_vector common_neighbours;
     neighbour_vector disjoint_neighbours;
 
@@ -397,122 +425,201 @@ void CurveballIM::run(const trade_vector &trades) {
 
     for (const auto &trade : trades) {
         handler.assureRunning();
+        numAffectedEdges += this->trade<false>(trade.first, trade.second, common_neighbours,
+                                               disjoint_neighbours, urng);
+    }
+}
 
-        // Trade partners u and v
-        const node u = trade.first;
-        const node v = trade.second;
+void CurveballIM::runParallel(const trade_vector &trades) {
+    // Two trades are independent if they involve different nodes and no edge connects their
+    // nodes; then they commute, and neither trade reads an adjacency row the other one writes.
+    // We repeatedly look for the longest prefix of the remaining trades that are pairwise
+    // independent and carry it out in parallel, so the result is distributed as if all trades
+    // had been carried out one after another.
+    //
+    // As all trades before the prefix have been carried out, every edge incident to a node of a
+    // trade in the prefix is stored in the row of this node or in the row of a node of an
+    // earlier trade in the prefix. Hence, scanning the rows of the nodes of all trades in the
+    // prefix finds every edge between two of them.
+    constexpr count minWindowSize = 64;
+
+    // the first trade in the current window that involves the node
+    std::vector<tradeid> firstTrade(numNodes, TRADELIST_END);
+    count windowSize = minWindowSize;
 
-        numAffectedEdges += adjList.degreeAt(u);
-        numAffectedEdges += adjList.degreeAt(v);
+    Aux::SignalHandler handler;
+    edgeid affectedEdges = 0;
 
-        // Shift the tradeList offset for these two, currently was set to
-        // trade_count
-        tradeList.incrementOffset(u);
-        tradeList.incrementOffset(v);
+    for (index begin = 0; begin < trades.size();) {
+        handler.assureRunning();
+        const index end = std::min<index>(trades.size(), begin + windowSize);
+
+        // trades that involve a node of an earlier trade in the window conflict
+        index batchEnd = end;
+        for (index t = begin; t < end; ++t) {
+            for (const node x : {trades[t].first, trades[t].second}) {
+                if (firstTrade[x] == TRADELIST_END)
+                    firstTrade[x] = static_cast<tradeid>(t);
+                else
+                    batchEnd = std::min(batchEnd, t);
+            }
+        }
 
-        // Retrieve respective neighbours
-        // we return whether u has v in his neighbors or vice-versa
-        auto organize_neighbors = [&](node node_x, node node_y) {
-            auto pos = std::find(adjList.begin(node_x), adjList.end(node_x), node_y);
-            if (pos == adjList.cend(node_x)) {
-                // element not found, sort anyway
-                std::sort(adjList.begin(node_x), adjList.end(node_x));
+        // trades connected by an edge conflict, the later one is not part of the batch
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for schedule(guided) reduction(min : batchEnd)
+#endif // NETWORKIT_OMP2
+        for (omp_index i = static_cast<omp_index>(begin); i < static_cast<omp_index>(end); ++i) {
+            const auto t = static_cast<tradeid>(i);
+            for (const node x : {trades[t].first, trades[t].second}) {
+                if (firstTrade[x] != t)
+                    continue;
+                for (auto it = adjList.cbegin(x); it != adjList.cend(x); ++it) {
+                    const tradeid other = firstTrade[*it];
+                    if (other != TRADELIST_END && other != t)
+                        batchEnd = std::min<index>(batchEnd, std::max(other, t));
+                }
+            }
+        }
+        assert(batchEnd > begin);
+
+#pragma omp parallel reduction(+ : affectedEdges)
+        {
+            neighbour_vector common_neighbours;
+            neighbour_vector disjoint_neighbours;
+            auto &urng = Aux::Random::getURNG();
+
+#pragma omp for schedule(dynamic, 1)
+            for (omp_index t = static_cast<omp_index>(begin); t < static_cast<omp_index>(batchEnd);
+                 ++t) {
+                affectedEdges += trade<true>(trades[t].first, trades[t].second, common_neighbours,
+                                             disjoint_neighbours, urng);
+            }
+        }
 
-                return false;
-            } else {
-                // overwrite node_y's position with END
-                *pos = LISTROW_END;
+        for (index t = begin; t < end; ++t) {
+            firstTrade[trades[t].first] = TRADELIST_END;
+            firstTrade[trades[t].second] = TRADELIST_END;
+        }
 
-                // sort, such that node_y's position is at end - 1
-                std::sort(adjList.begin(node_x), adjList.end(node_x));
+        // grow the window if the whole window was independent, shrink it otherwise
+        windowSize = std::max(minWindowSize, 2 * (batchEnd - begin));
+        begin = batchEnd;
+    }
 
-                // overwrite with node_y again
-                *(adjList.end(node_x) - 1) = node_y;
+    numAffectedEdges += affectedEdges;
+}
 
-                return true;
-            }
-        };
-
-        const bool u_share = organize_neighbors(u, v);
-        const bool v_share = organize_neighbors(v, u);
-        auto u_end = (u_share ? adjList.cend(u) - 1 : adjList.cend(u));
-        auto v_end = (v_share ? adjList.cend(v) - 1 : adjList.cend(v));
-
-        const bool shared = u_share || v_share;
-
-        // both can't have each other, only inserted in one
-        assert((!u_share && !v_share) || (u_share != v_share));
-
-        // No need to keep track of direct positions
-        // Get common and disjoint neighbors
-        // Here sort and parallel scan
-        common_neighbours.clear();
-        disjoint_neighbours.clear();
-        auto u_nit = adjList.cbegin(u);
-        auto v_nit = adjList.cbegin(v);
-        while ((u_nit != u_end) && (v_nit != v_end)) {
-            assert(*u_nit != v);
-            assert(*v_nit != u);
-            if (*u_nit > *v_nit) {
-                disjoint_neighbours.push_back(*v_nit);
-                v_nit++;
-                continue;
-            }
-            if (*u_nit < *v_nit) {
-                disjoint_neighbours.push_back(*u_nit);
-                u_nit++;
-                continue;
-            }
-            // *u_nit == *v_nit
-            {
-                common_neighbours.push_back(*u_nit);
-                u_nit++;
-                v_nit++;
-            }
+template <bool Concurrent>
+edgeid CurveballIM::trade(node u, node v, neighbour_vector &common_neighbours,
+                          neighbour_vector &disjoint_neighbours, std::mt19937_64 &urng) {
+    const edgeid affectedEdges = adjList.degreeAt(u) + adjList.degreeAt(v);
+
+    // Shift the tradeList offset for these two, currently was set to
+    // trade_count
+    tradeList.incrementOffset(u);
+    tradeList.incrementOffset(v);
+
+    // Retrieve respective neighbours
+    // we return whether u has v in his neighbors or vice-versa
+    auto organize_neighbors = [&](node node_x, node node_y) {
+        auto pos = std::find(adjList.begin(node_x), adjList.end(node_x), node_y);
+        if (pos == adjList.cend(node_x)) {
+            // element not found, sort anyway
+            std::sort(adjList.begin(node_x), adjList.end(node_x));
+
+            return false;
+        } else {
+            // overwrite node_y's position with END
+            *pos = LISTROW_END;
+
+            // sort, such that node_y's position is at end - 1
+            std::sort(adjList.begin(node_x), adjList.end(node_x));
+
+            // overwrite with node_y again
+            *(adjList.end(node_x) - 1) = node_y;
+
+            return true;
         }
-        if (u_nit == u_end)
-            disjoint_neighbours.insert(disjoint_neighbours.end(), v_nit, v_end);
-        else
-            disjoint_neighbours.insert(disjoint_neighbours.end(), u_nit, u_end);
-
-        const count u_setsize =
-            static_cast<count>(u_end - adjList.cbegin(u) - common_neighbours.size());
-        const count v_setsize =
-            static_cast<count>(v_end - adjList.cbegin(v) - common_neighbours.size());
-        // v_setsize not necessarily needed
-
-        // Reset fst/snd row
-        adjList.resetRow(u);
-        adjList.resetRow(v);
-
-        tlx::random_bipartition_shuffle(disjoint_neighbours.begin(), disjoint_neighbours.end(),
-                                        u_setsize, urng);
-
-        // Assign first u_setsize to u and last v_setsize to v
-        // if not existent then max value, and below compare goes in favor of
-        // partner, if partner has no more neighbours as well then their values are
-        // equal (max and equal) and tiebreaking is applied
-        for (count counter = 0; counter < u_setsize; counter++) {
-            const node swapped = disjoint_neighbours[counter];
-            update(u, swapped);
+    };
+
+    const bool u_share = organize_neighbors(u, v);
+    const bool v_share = organize_neighbors(v, u);
+    auto u_end = (u_share ? adjList.cend(u) - 1 : adjList.cend(u));
+    auto v_end = (v_share ? adjList.cend(v) - 1 : adjList.cend(v));
+
+    const bool shared = u_share || v_share;
+
+    // both can't have each other, only inserted in one
+    assert((!u_share && !v_share) || (u_share != v_share));
+
+    // No need to keep track of direct positions
+    // Get common and disjoint neighbors
+    // Here sort and parallel scan
+    common_neighbours.clear();
+    disjoint_neighbours.clear();
+    auto u_nit = adjList.cbegin(u);
+    auto v_nit = adjList.cbegin(v);
+    while ((u_nit != u_end) && (v_nit != v_end)) {
+        assert(*u_nit != v);
+        assert(*v_nit != u);
+        if (*u_nit > *v_nit) {
+            disjoint_neighbours.push_back(*v_nit);
+            v_nit++;
+            continue;
         }
-        for (count counter = u_setsize; counter < u_setsize + v_setsize; counter++) {
-            const node swapped = disjoint_neighbours[counter];
-            update(v, swapped);
+        if (*u_nit < *v_nit) {
+            disjoint_neighbours.push_back(*u_nit);
+            u_nit++;
+            continue;
         }
-        // Distribute common edges
-        for (const auto common : common_neighbours) {
-            update(u, common);
-            update(v, common);
+        // *u_nit == *v_nit
+        {
+            common_neighbours.push_back(*u_nit);
+            u_nit++;
+            v_nit++;
         }
-        // Do not forget edge between u and v
-        if (shared)
-            update(u, v);
     }
+    if (u_nit == u_end)
+        disjoint_neighbours.insert(disjoint_neighbours.end(), v_nit, v_end);
+    else
+        disjoint_neighbours.insert(disjoint_neighbours.end(), u_nit, u_end);
+
+    const count u_setsize =
+        static_cast<count>(u_end - adjList.cbegin(u) - common_neighbours.size());
+    const count v_setsize =
+        static_cast<count>(v_end - adjList.cbegin(v) - common_neighbours.size());
+    // v_setsize not necessarily needed
+
+    // Reset fst/snd row
+    adjList.resetRow(u);
+    adjList.resetRow(v);
+
+    tlx::random_bipartition_shuffle(disjoint_neighbours.begin(), disjoint_neighbours.end(),
+                                    u_setsize, urng);
+
+    // Assign first u_setsize to u and last v_setsize to v
+    // if not existent then max value, and below compare goes in favor of
+    // partner, if partner has no more neighbours as well then their values are
+    // equal (max and equal) and tiebreaking is applied
+    for (count counter = 0; counter < u_setsize; counter++) {
+        const node swapped = disjoint_neighbours[counter];
+        update<Concurrent>(u, swapped);
+    }
+    for (count counter = u_setsize; counter < u_setsize + v_setsize; counter++) {
+        const node swapped = disjoint_neighbours[counter];
+        update<Concurrent>(v, swapped);
+    }
+    // Distribute common edges
+    for (const auto common : common_neighbours) {
+        update<Concurrent>(u, common);
+        update<Concurrent>(v, common);
+    }
+    // Do not forget edge between u and v
+    if (shared)
+        update<Concurrent>(u, v);
 
-    hasRun = true;
-
-    return;
+    return affectedEdges;
 }
 
 Graph CurveballIM::getGraph(bool parallel) const {
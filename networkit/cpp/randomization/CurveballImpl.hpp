@@ -7,7 +7,9 @@
 #define RANDOMIZATION_CURVEBALL_IMPL_H
 
 #include <cassert>
+#include <random>
 #include <utility>
+#include <vector>
 
 #include <networkit/Globals.hpp>
 #include <networkit/graph/Graph.hpp>
@@ -21,6 +23,7 @@ using tradeid = node;
 using count = node;
 
 using trade_vector = std::vector<trade_descriptor>;
+using neighbour_vector = std::vector<node>;
 using nodepair_vector = std::vector<std::pair<node, node>>;
 
 constexpr node INVALID_NODE = std::numeric_limits<node>::max();
@@ -81,6 +84,21 @@ public:
         offsets[node_id]++;
     }
 
+    // Like insertNeighbour, but may be called concurrently for the same node
+    void insertNeighbourAtomic(node node_id, node neighbour) {
+        count offset;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic capture
+#else
+#pragma omp critical(CurveballInsertNeighbour)
+#endif // NETWORKIT_OMP2
+        offset = offsets[node_id]++;
+
+        assert(neighbours[begins[node_id] + offset] != LISTROW_END);
+
+        neighbours[begins[node_id] + offset] = neighbour;
+    }
+
     node numberOfNodes() const { return static_cast<node>(offsets.size()); }
 
     node numberOfEdges() const { return static_cast<edgeid>(degreeCount); }
@@ -163,6 +181,8 @@ public:
 
     void run(const trade_vector &trades);
 
+    void setParallel(bool parallel) noexcept { this->parallel = parallel; }
+
     count getNumberOfAffectedEdges() const {
         assert(hasRun);
         return numAffectedEdges;
@@ -177,6 +197,7 @@ private:
     const node numNodes;
 
     bool hasRun;
+    bool parallel = true;
     CurveballAdjacencyList adjList;
     TradeList tradeList;
     count maxDegree;
@@ -186,19 +207,29 @@ private:
 
     void restructureGraph(const trade_vector &trades);
 
+    // Carries out the trades one after another
+    void runSequential(const trade_vector &trades);
+
+    // Carries out batches of consecutive independent trades in parallel
+    void runParallel(const trade_vector &trades);
+
+    // Carries out the trade between u and v and returns the number of affected half-edges. If
+    // Concurrent is true, other independent trades may be carried out at the same time.
+    template <bool Concurrent>
+    edgeid trade(node u, node v, neighbour_vector &common_neighbours,
+                 neighbour_vector &disjoint_neighbours, std::mt19937_64 &urng);
+
+    template <bool Concurrent = false>
     inline void update(node a, node b) {
         const tradeid ta = *(tradeList.getTrades(a));
         const tradeid tb = *(tradeList.getTrades(b));
-        if (ta < tb) {
+        if (ta > tb)
+            std::swap(a, b);
+
+        if (Concurrent)
+            adjList.insertNeighbourAtomic(a, b);
+        else
             adjList.insertNeighbour(a, b);
-            return;
-        }
-
-        if (ta > tb) {
-            adjList.insertNeighbour(b, a);
-            return;
-        }
-        { adjList.insertNeighbour(a, b); }
     }
 };
 
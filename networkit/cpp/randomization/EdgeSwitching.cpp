@@ -1,12 +1,26 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <random>
 #include <stdexcept>
+#include <thread>
 
 #include <networkit/auxiliary/Random.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/auxiliary/SpinLock.hpp>
 #include <networkit/randomization/DegreePreservingShuffle.hpp>
 #include <networkit/randomization/EdgeSwitching.hpp>
 
 namespace NetworKit {
 
+namespace {
+// Number of switches carried out between two checks for interruption.
+constexpr count switchesPerRound = count{1} << 22;
+// Maximum number of times a thread yields after failing to acquire the locks of a switch.
+constexpr count maxBackoff = 64;
+} // namespace
+
 void EdgeSwitchingInPlace::run() {
     auto numberOfSwitches =
         static_cast<count>(std::ceil(graph.numberOfEdges() * numberOfSwitchesPerEdge));
@@ -15,37 +29,90 @@ void EdgeSwitchingInPlace::run() {
         return;
 
     if (!hasRun) {
-        degreeDistribution = std::discrete_distribution<node>(
-            graph.numberOfNodes(), //
-            0.0, static_cast<double>(graph.numberOfNodes()),
-            [&](double x) { return graph.degree(static_cast<node>(x)); });
+        degreePrefixSum.assign(graph.upperNodeIdBound() + 1, 0);
+        graph.parallelForNodes([&](node u) { degreePrefixSum[u + 1] = graph.degree(u); });
+        std::partial_sum(degreePrefixSum.begin(), degreePrefixSum.end(), degreePrefixSum.begin());
     }
 
-    auto &urng = Aux::Random::getURNG();
+    const auto sourceOf = [&](edgeid e) -> node {
+        return std::upper_bound(degreePrefixSum.begin(), degreePrefixSum.end(), e)
+               - degreePrefixSum.begin() - 1;
+    };
+
+    std::vector<Aux::Spinlock> locks(graph.upperNodeIdBound());
+
+    // Switches the e1-th and the e2-th edge unless this creates a multi-edge or a self-loop.
+    // The endpoints are locked before their neighborhoods are read; if another thread holds one
+    // of the locks, all locks are released and the switch is attempted again after an
+    // exponentially growing backoff, so that competing threads do not retry in lockstep.
+    const auto trySwitch = [&](edgeid e1, edgeid e2) -> bool {
+        const node s1 = sourceOf(e1);
+        const node s2 = sourceOf(e2);
+        if (s1 == s2) // the switch would create a multi-edge
+            return false;
+
+        std::array<node, 4> lockedNodes;
+        count numberOfLockedNodes = 0;
+        const auto tryLock = [&](node u) {
+            if (std::find(lockedNodes.begin(), lockedNodes.begin() + numberOfLockedNodes, u)
+                != lockedNodes.begin() + numberOfLockedNodes)
+                return true;
+            if (!locks[u].try_lock())
+                return false;
+            lockedNodes[numberOfLockedNodes++] = u;
+            return true;
+        };
+        const auto unlockAll = [&] {
+            for (index i = 0; i < numberOfLockedNodes; ++i)
+                locks[lockedNodes[i]].unlock();
+            numberOfLockedNodes = 0;
+        };
+
+        for (count backoff = 1;; backoff = std::min(2 * backoff, maxBackoff)) {
+            if (tryLock(s1) && tryLock(s2)) {
+                const node t1 = graph.getIthNeighbor(s1, e1 - degreePrefixSum[s1]);
+                const node t2 = graph.getIthNeighbor(s2, e2 - degreePrefixSum[s2]);
+                if (s2 == t1 || t1 == t2 || s1 == t2) {
+                    unlockAll();
+                    return false;
+                }
+
+                if (tryLock(t1) && tryLock(t2)) {
+                    const bool legal = !graph.hasEdge(s2, t1) && !graph.hasEdge(s1, t2);
+                    if (legal)
+                        graph.swapEdge(s1, t1, s2, t2);
+                    unlockAll();
+                    return legal;
+                }
+            }
+            unlockAll();
+            for (count i = 0; i < backoff; ++i)
+                std::this_thread::yield();
+        }
+    };
+
     Aux::SignalHandler handler;
-    while (numberOfSwitches--) {
+    count numberOfSwaps = 0;
+    while (numberOfSwitches > 0) {
         handler.assureRunning();
-        const auto s1 = degreeDistribution(urng);
-        const auto s2 = degreeDistribution(urng);
-
-        // we avoid GraphTools::randomNeighbor to avoid the implicit cost of accessing the
-        // Aux::Random::getURNG
-        const auto i1 = std::uniform_int_distribution<index>{0, graph.degree(s1) - 1}(urng);
-        const auto t1 = graph.getIthNeighbor(s1, i1);
-
-        if (s2 == t1 || graph.hasEdge(s2, t1)) // early reject
-            continue;
-
-        const auto i2 = std::uniform_int_distribution<index>{0, graph.degree(s2) - 1}(urng);
-        const auto t2 = graph.getIthNeighbor(s2, i2);
-
-        if (t1 == t2 || s1 == t2 || graph.hasEdge(s1, t2)) // remaining checks
-            continue;
-
-        graph.swapEdge(s1, t1, s2, t2);
-
-        ++numberOfSwapsPerformed;
+        const count switchesInRound = std::min(numberOfSwitches, switchesPerRound);
+        numberOfSwitches -= switchesInRound;
+
+#pragma omp parallel reduction(+ : numberOfSwaps) if (parallel)
+        {
+            auto &urng = Aux::Random::getURNG();
+            std::uniform_int_distribution<edgeid> edgeDistribution{0,
+                                                                   degreePrefixSum.back() - 1};
+
+#pragma omp for schedule(static)
+            for (omp_index i = 0; i < static_cast<omp_index>(switchesInRound); ++i) {
+                const edgeid e1 = edgeDistribution(urng);
+                const edgeid e2 = edgeDistribution(urng);
+                numberOfSwaps += trySwitch(e1, e2);
+            }
+        }
     }
+    numberOfSwapsPerformed += numberOfSwaps;
 
     hasRun = true;
 }
@@ -5,6 +5,10 @@
  *  Author: Author: Hung Tran <htran@ae.cs.uni-frankfurt.de>
  */
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <networkit/graph/Graph.hpp>
 
@@ -117,4 +121,98 @@ TEST_F(CurveballGTest, testCurveballMaterialization) {
     this->checkWithGraph(G, true);
 }
 
+TEST_F(CurveballGTest, testCurveballManyTrades) {
+    Aux::Random::setSeed(1, false);
+
+    node numNodes = 2000;
+    Graph G = ErdosRenyiGenerator(numNodes, 0.005).generate();
+    // Curveball does not support isolated nodes
+    G.forNodes([&](node u) {
+        if (G.degree(u) == 0)
+            G.addEdge(u, (u + 1) % numNodes);
+    });
+
+    Curveball algo(G);
+    CurveballUniformTradeGenerator gen(10 * numNodes, numNodes);
+    const auto trades = gen.generate();
+    algo.run(trades);
+
+    edgeid affectedEdges = 0;
+    for (const auto &trade : trades)
+        affectedEdges += G.degree(trade.first) + G.degree(trade.second);
+    EXPECT_EQ(algo.getNumberOfAffectedEdges(), affectedEdges);
+
+    Graph outG = algo.getGraph(true);
+    EXPECT_EQ(outG.numberOfEdges(), G.numberOfEdges());
+    EXPECT_TRUE(outG.checkConsistency()); // no multi-edges
+
+    count commonEdges = 0;
+    outG.forNodes([&](node u) {
+        EXPECT_EQ(outG.degree(u), G.degree(u));
+        EXPECT_FALSE(outG.hasEdge(u, u));
+        outG.forNeighborsOf(u, [&](node v) { commonEdges += G.hasEdge(u, v); });
+    });
+
+    // after 10 trades per node, only few edges of the sparse input graph remain
+    EXPECT_LT(commonEdges / 2, G.numberOfEdges() / 10);
+}
+
+TEST_F(CurveballGTest, testCurveballSelfTrades) {
+    Aux::Random::setSeed(1, false);
+
+    const node numNodes = 500;
+    Graph G = ErdosRenyiGenerator(numNodes, 0.02).generate();
+    G.forNodes([&](node u) {
+        if (G.degree(u) == 0)
+            G.addEdge(u, (u + 1) % numNodes);
+    });
+
+    auto trades = CurveballUniformTradeGenerator(5 * numNodes, numNodes).generate();
+    edgeid affectedEdges = 0;
+    for (const auto &trade : trades)
+        affectedEdges += G.degree(trade.first) + G.degree(trade.second);
+
+    // self-trades at the beginning, in the middle and at the end do not change the graph
+    trades.insert(trades.begin(), {7, 7});
+    trades.insert(trades.begin() + trades.size() / 2, {3, 3});
+    trades.emplace_back(11, 11);
+
+    for (const bool parallel : {false, true}) {
+        Curveball algo(G);
+        algo.setParallel(parallel);
+        algo.run(trades);
+        EXPECT_EQ(algo.getNumberOfAffectedEdges(), affectedEdges);
+
+        const Graph outG = algo.getGraph();
+        EXPECT_EQ(outG.numberOfEdges(), G.numberOfEdges());
+        EXPECT_TRUE(outG.checkConsistency());
+        outG.forNodes([&](node u) {
+            EXPECT_EQ(outG.degree(u), G.degree(u));
+            EXPECT_FALSE(outG.hasEdge(u, u));
+        });
+    }
+}
+
+TEST_F(CurveballGTest, testCurveballSequentialIsReproducible) {
+    const auto randomize = [] {
+        Aux::Random::setSeed(1, false);
+        const node numNodes = 200;
+        Graph G(numNodes);
+        for (node u = 0; u < numNodes; ++u)
+            for (node i = 1; i <= 3; ++i)
+                G.addEdge(u, (u + i) % numNodes);
+
+        Curveball algo(G);
+        algo.setParallel(false);
+        algo.run(CurveballUniformTradeGenerator(10 * numNodes, numNodes).generate());
+        const Graph outG = algo.getGraph();
+        std::vector<std::pair<node, node>> edges;
+        outG.forEdges([&](node u, node v) { edges.emplace_back(std::min(u, v), std::max(u, v)); });
+        std::sort(edges.begin(), edges.end());
+        return edges;
+    };
+
+    EXPECT_EQ(randomize(), randomize());
+}
+
 } // namespace NetworKit
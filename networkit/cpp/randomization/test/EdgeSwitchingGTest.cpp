@@ -7,6 +7,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <networkit/graph/Graph.hpp>
 #include <networkit/randomization/EdgeSwitching.hpp>
 
@@ -183,4 +187,56 @@ TEST_P(EdgeSwitchingGTest, testPreprocessing) {
     }
 }
 
+TEST_P(EdgeSwitchingGTest, testDegreesAndSimplicity) {
+    Aux::Random::setSeed(1, true);
+
+    // a ring where every node is connected to its next five successors, and a hub connected to
+    // every third node, so that many concurrent switches involve the hub
+    constexpr count kNumNodes = 2000;
+    Graph G(kNumNodes + 1, false, isDirected());
+    for (node u = 0; u < kNumNodes; ++u)
+        for (node i = 1; i <= 5; ++i)
+            G.addEdge(u, (u + i) % kNumNodes);
+    for (node u = 0; u < kNumNodes; u += 3)
+        G.addEdge(kNumNodes, u);
+
+    std::vector<count> outDegrees(G.upperNodeIdBound()), inDegrees(G.upperNodeIdBound());
+    G.forNodes([&](node u) {
+        outDegrees[u] = G.degreeOut(u);
+        inDegrees[u] = G.degreeIn(u);
+    });
+
+    EdgeSwitchingInPlace algo(G, 20);
+    algo.run();
+    EXPECT_GT(algo.getNumberOfAffectedEdges(), G.numberOfEdges());
+
+    EXPECT_TRUE(G.checkConsistency()); // no multi-edges
+    G.forNodes([&](node u) {
+        EXPECT_EQ(G.degreeOut(u), outDegrees[u]);
+        EXPECT_EQ(G.degreeIn(u), inDegrees[u]);
+
+        EXPECT_FALSE(G.hasEdge(u, u));
+    });
+}
+
+TEST_P(EdgeSwitchingGTest, testSequentialIsReproducible) {
+    const auto randomize = [&] {
+        Aux::Random::setSeed(1, false);
+        Graph G(100, false, isDirected());
+        for (node u = 0; u < 100; ++u)
+            for (node i = 1; i <= 3; ++i)
+                G.addEdge(u, (u + i) % 100);
+
+        EdgeSwitchingInPlace algo(G, 10);
+        algo.setParallel(false);
+        algo.run();
+        std::vector<std::pair<node, node>> edges;
+        G.forEdges([&](node u, node v) { edges.emplace_back(u, v); });
+        std::sort(edges.begin(), edges.end());
+        return edges;
+    };
+
+    EXPECT_EQ(randomize(), randomize());
+}
+
 } // namespace NetworKit
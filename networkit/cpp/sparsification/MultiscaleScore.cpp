@@ -5,6 +5,8 @@
  *      Author: Gerd Lindner
  */
 
+#include <algorithm>
+
 #include <networkit/sparsification/MultiscaleScore.hpp>
 
 namespace NetworKit {
@@ -17,38 +19,23 @@ void MultiscaleScore::run() {
         throw std::runtime_error("edges have not been indexed - call indexEdges first");
     }
 
-    // The following vector is used for the _local_ normalization of edgeweights.
-    // We use a global vector for performance reasons.
-    std::vector<edgeweight> normalizedWeights(G->upperNodeIdBound());
-
-    std::vector<double> multiscaleAttribute(G->upperEdgeIdBound(), 0.0);
-
-    G->forNodes([&](node u) {
-        count k = G->degree(u);
-
-        // Normalize edgeweights of N(u)
+    // Sum of the attribute over the edges of every node, used for the _local_ normalization.
+    std::vector<edgeweight> attributeSum(G->upperNodeIdBound(), 0.0);
+    G->balancedParallelForNodes([&](node u) {
         edgeweight sum = 0.0;
         G->forNeighborsOf(u, [&](node, node, edgeid eid) { sum += (*attribute)[eid]; });
-        G->forNeighborsOf(
-            u, [&](node, node v, edgeid eid) { normalizedWeights[v] = (*attribute)[eid] / sum; });
+        attributeSum[u] = sum;
+    });
 
-        // Filter edges by probability
-        G->forNeighborsOf(u, [&](node, node v, edgeid eid) {
-            // In case d(u) == 1 and d(v) > 1: ignore u
-            // if (k > 1 || G.degree(v) == 1) {
-            edgeweight p = normalizedWeights[v];
-            double probability = getProbability(k, p);
+    std::vector<double> multiscaleAttribute(G->upperEdgeIdBound(), 0.0);
 
-#if defined(__GNUC__) && (__GNUC__ >= 12)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-            multiscaleAttribute[eid] = std::max(multiscaleAttribute[eid], probability);
-#if defined(__GNUC__) && (__GNUC__ >= 12)
-#pragma GCC diagnostic pop
-#endif
-            //}
-        });
+    // An edge is kept with the larger of the probabilities computed at its endpoints.
+    G->parallelForEdges([&](node u, node v, edgeid eid) {
+        const edgeweight w = (*attribute)[eid];
+        double probability = getProbability(G->degree(u), w / attributeSum[u]);
+        if (!G->isDirected())
+            probability = std::max(probability, getProbability(G->degree(v), w / attributeSum[v]));
+        multiscaleAttribute[eid] = probability;
     });
 
     scoreData = std::move(multiscaleAttribute);
@@ -5,6 +5,7 @@
  *      Author: Gerd Lindner
  */
 
+#include <algorithm>
 #include <limits>
 #include <networkit/sparsification/SimmelianScore.hpp>
 
@@ -18,8 +19,9 @@ SimmelianScore::getRankedNeighborhood(const Graph &g, const std::vector<count> &
     std::vector<RankedNeighbors> neighbors;
     neighbors.resize(g.upperNodeIdBound());
 
-    g.forNodes([&](node u) {
+    g.balancedParallelForNodes([&](node u) {
         // Sort ego's alters from strongly to weakly tied.
+        neighbors[u].reserve(g.degree(u));
         g.forNeighborsOf(u, [&](node, node v, edgeid eid) {
             count triangleCount = std::round(triangles[eid]);
             neighbors[u].emplace_back(u, v, triangleCount);
@@ -57,7 +59,7 @@ Redundancy SimmelianScore::getOverlap(const node &ego, const node &alter,
     std::unordered_set<node> egoNeighborsUnmatched;
     std::unordered_set<node> alterNeighborsUnmatched;
 
-    for (count rank = 0; rank <= maxRank; rank++) {
+    for (count rank = 0; rank <= maxRank;) {
         matchNeighbors(ego, alter, true, egoIt, neighbors[ego], egoNeighborsUnmatched,
                        alterNeighborsUnmatched, rank, result.overlap);
         matchNeighbors(alter, ego, false, alterIt, neighbors[alter], alterNeighborsUnmatched,
@@ -70,26 +72,35 @@ Redundancy SimmelianScore::getOverlap(const node &ego, const node &alter,
                                       + alterNeighborsUnmatched.size());
 
         result.jaccard = std::max(currentJaccard, result.jaccard);
+
+        // Ranks that neither neighborhood contains do not change the result.
+        constexpr count noRank = std::numeric_limits<count>::max();
+        const count egoRank = egoIt != neighbors[ego].end() ? egoIt->rank : noRank;
+        const count alterRank = alterIt != neighbors[alter].end() ? alterIt->rank : noRank;
+        rank = std::min(egoRank, alterRank);
+        if (rank == noRank)
+            break;
     }
 
     return result;
 }
 
 /**
- * Helper function used in getOverlap. Adds the intersection of
- * egoNeighbors and alterNeighborsUnmatched to overlap.
+ * Helper function used in getOverlap. Advances egoIt over the neighbors of the given rank and
+ * adds the intersection of these neighbors and alterNeighborsUnmatched to overlap.
  */
 void SimmelianScore::matchNeighbors(node, node alter, bool,
-                                    std::vector<RankedEdge>::const_iterator &,
+                                    std::vector<RankedEdge>::const_iterator &egoIt,
                                     const RankedNeighbors &egoNeighbors,
                                     std::unordered_set<node> &egoNeighborsUnmatched,
                                     std::unordered_set<node> &alterNeighborsUnmatched, count rank,
                                     count &overlap) {
 
-    for (auto egoIt : egoNeighbors) {
-        node other = egoIt.alter;
+    // The neighbors are sorted by rank, so the ones of smaller ranks have already been matched.
+    for (; egoIt != egoNeighbors.end() && egoIt->rank <= rank; ++egoIt) {
+        node other = egoIt->alter;
 
-        if (other == alter || egoIt.rank != rank)
+        if (other == alter)
             continue;
 
         if (alterNeighborsUnmatched.erase(other))
@@ -6,6 +6,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <limits>
 
 #include <networkit/edgescores/ChibaNishizekiTriangleEdgeScore.hpp>
 #include <networkit/sparsification/SimmelianOverlapScore.hpp>
@@ -55,6 +56,11 @@ TEST_F(SimmelianBackboneGTest, testOverlapCounting) {
     r = simmel.getOverlap(0, 1, neighbors, 3);
     EXPECT_EQ(2, r.overlap) << "wrong overlap";
     EXPECT_DOUBLE_EQ((2.0 / 5.0), r.jaccard) << "wrong jaccard index";
+
+    // Ranks beyond the largest one in both neighborhoods do not change the result.
+    r = simmel.getOverlap(0, 1, neighbors, std::numeric_limits<count>::max());
+    EXPECT_EQ(2, r.overlap) << "wrong overlap";
+    EXPECT_DOUBLE_EQ((2.0 / 5.0), r.jaccard) << "wrong jaccard index";
 }
 
 TEST_F(SimmelianBackboneGTest, testRankedNeighborhood) {
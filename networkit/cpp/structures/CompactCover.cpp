@@ -0,0 +1,206 @@
+/*
+ * CompactCover.cpp
+ */
+
+#include <atomic>
+#include <numeric>
+
+#include <networkit/structures/CompactCover.hpp>
+
+namespace NetworKit {
+
+CompactCover::CompactCover(const Cover &C) : offsets(C.numberOfElements() + 1, 0) {
+    for (index e = 0; e < C.numberOfElements(); ++e)
+        offsets[e + 1] = offsets[e] + C[e].size();
+
+    subsets.resize(offsets.back());
+    C.parallelForEntries([&](index e, const std::set<index> &s) {
+        std::copy(s.begin(), s.end(), subsets.begin() + static_cast<std::ptrdiff_t>(offsets[e]));
+    });
+    upper = C.upperBound();
+}
+
+CompactCover::CompactCover(const Partition &P) : offsets(P.numberOfElements() + 1, 0) {
+    for (index e = 0; e < P.numberOfElements(); ++e)
+        offsets[e + 1] = offsets[e] + (P[e] != none);
+
+    subsets.resize(offsets.back());
+    P.parallelForEntries([&](index e, index s) {
+        if (s != none)
+            subsets[offsets[e]] = s;
+    });
+    upper = P.upperBound();
+}
+
+bool CompactCover::inSameSubset(index e1, index e2) const {
+    auto it1 = subsetsBegin(e1), it2 = subsetsBegin(e2);
+    const auto end1 = subsetsEnd(e1), end2 = subsetsEnd(e2);
+    while (it1 != end1 && it2 != end2) {
+        if (*it1 < *it2)
+            ++it1;
+        else if (*it2 < *it1)
+            ++it2;
+        else
+            return true;
+    }
+    return false;
+}
+
+count CompactCover::numberOfCommonSubsets(index e1, index e2) const {
+    auto it1 = subsetsBegin(e1), it2 = subsetsBegin(e2);
+    const auto end1 = subsetsEnd(e1), end2 = subsetsEnd(e2);
+    count common = 0;
+    while (it1 != end1 && it2 != end2) {
+        if (*it1 < *it2) {
+            ++it1;
+        } else if (*it2 < *it1) {
+            ++it2;
+        } else {
+            ++common;
+            ++it1;
+            ++it2;
+        }
+    }
+    return common;
+}
+
+std::vector<index> CompactCover::getMembers(index s) const {
+    std::vector<index> members;
+    for (index e = 0; e < numberOfElements(); ++e)
+        if (isInSubset(e, s))
+            members.push_back(e);
+    return members;
+}
+
+std::vector<count> CompactCover::subsetSizes() const {
+    std::vector<count> sizes(upperBound(), 0);
+    for (const index s : subsets)
+        ++sizes[s];
+    return sizes;
+}
+
+std::map<index, count> CompactCover::subsetSizeMap() const {
+    const auto sizes = subsetSizes();
+    std::map<index, count> sizeMap;
+    for (index s = 0; s < sizes.size(); ++s)
+        if (sizes[s])
+            sizeMap.emplace_hint(sizeMap.end(), s, sizes[s]);
+    return sizeMap;
+}
+
+count CompactCover::numberOfSubsets() const {
+    const auto sizes = subsetSizes();
+    return static_cast<count>(
+        std::count_if(sizes.begin(), sizes.end(), [](count size) { return size > 0; }));
+}
+
+Cover CompactCover::toCover() const {
+    Cover C(numberOfElements());
+    C.setUpperBound(upperBound());
+    forEntries([&](index e, index s) { C[e].insert(C[e].end(), s); });
+    return C;
+}
+
+namespace {
+// Builder ids start at 1, so that the empty slots of the thread-local buffer caches never match.
+std::atomic<uint64_t> nextBuilderId{1};
+} // namespace
+
+thread_local CompactCoverBuilder::LocalBuffers CompactCoverBuilder::localBuffers;
+
+CompactCoverBuilder::CompactCoverBuilder(count n) : n(n), id(nextBuilderId++) {}
+
+CompactCoverBuilder::Memberships &CompactCoverBuilder::newLocalMemberships() {
+    Memberships *buffer;
+    {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        memberships.push_back(std::make_unique<Memberships>());
+        buffer = memberships.back().get();
+    }
+    const index slot = localBuffers.next;
+    localBuffers.next = (slot + 1) % LocalBuffers::size;
+    localBuffers.ids[slot] = id;
+    localBuffers.buffers[slot] = buffer;
+    return *buffer;
+}
+
+CompactCover CompactCoverBuilder::build() {
+    // Take over the buffers; the new id invalidates the buffers cached by the threads.
+    std::vector<std::unique_ptr<Memberships>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        buffers.swap(memberships);
+        id = nextBuilderId++;
+    }
+
+    CompactCover result;
+    result.offsets.assign(n + 1, 0);
+    index upper = 1;
+    // Without max reductions and atomic captures (NETWORKIT_OMP2), both passes over the buffers
+    // run sequentially.
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel reduction(max : upper)
+#endif // NETWORKIT_OMP2
+    for (const auto &buffer : buffers) {
+#pragma omp for schedule(static) nowait
+        for (omp_index i = 0; i < static_cast<omp_index>(buffer->size()); ++i) {
+            const auto &membership = (*buffer)[i];
+#pragma omp atomic
+            ++result.offsets[membership.first + 1];
+            upper = std::max(upper, membership.second + 1);
+        }
+    }
+    std::partial_sum(result.offsets.begin(), result.offsets.end(), result.offsets.begin());
+
+    result.subsets.resize(result.offsets.back());
+    {
+        std::vector<index> pos(result.offsets.begin(), result.offsets.end() - 1);
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel
+#endif // NETWORKIT_OMP2
+        for (const auto &buffer : buffers) {
+#pragma omp for schedule(static) nowait
+            for (omp_index i = 0; i < static_cast<omp_index>(buffer->size()); ++i) {
+                const auto &membership = (*buffer)[i];
+                index slot;
+#ifndef NETWORKIT_OMP2
+#pragma omp atomic capture
+#endif // NETWORKIT_OMP2
+                slot = pos[membership.first]++;
+                result.subsets[slot] = membership.second;
+            }
+        }
+        buffers.clear();
+    }
+
+    // Sort the subsets of each element and remove duplicates; the new size is stored in sizes.
+    // Sorting also makes the result independent of the order of the insertions.
+    std::vector<count> sizes(n);
+    bool duplicates = false;
+#pragma omp parallel for schedule(guided) reduction(|| : duplicates)
+    for (omp_index e = 0; e < static_cast<omp_index>(n); ++e) {
+        const auto begin = result.subsets.begin() + static_cast<std::ptrdiff_t>(result.offsets[e]);
+        const auto end =
+            result.subsets.begin() + static_cast<std::ptrdiff_t>(result.offsets[e + 1]);
+        std::sort(begin, end);
+        sizes[e] = static_cast<count>(std::unique(begin, end) - begin);
+        duplicates = duplicates || (sizes[e] != result.offsets[e + 1] - result.offsets[e]);
+    }
+
+    if (duplicates) {
+        std::vector<index> offsets(n + 1, 0);
+        std::partial_sum(sizes.begin(), sizes.end(), offsets.begin() + 1);
+        std::vector<index> subsets(offsets.back());
+#pragma omp parallel for schedule(guided)
+        for (omp_index e = 0; e < static_cast<omp_index>(n); ++e)
+            std::copy_n(result.subsets.begin() + static_cast<std::ptrdiff_t>(result.offsets[e]),
+                        sizes[e], subsets.begin() + static_cast<std::ptrdiff_t>(offsets[e]));
+        result.offsets = std::move(offsets);
+        result.subsets = std::move(subsets);
+    }
+
+    result.upper = upper;
+    return result;
+}
+
+} /* namespace NetworKit */
@@ -6,8 +6,11 @@
  */
 
 #include <gtest/gtest.h>
+#include <omp.h>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/structures/CompactCover.hpp>
 #include <networkit/structures/Cover.hpp>
 
 #include <iostream>
@@ -275,4 +278,128 @@ TEST_F(CoverGTest, testInSameSubset) {
     EXPECT_TRUE(c.inSameSubset(1, 5));
 }
 
+TEST_F(CoverGTest, testCompactCoverFromCover) {
+    Aux::Random::setSeed(42, false);
+    constexpr count n = 200;
+    Cover c(n);
+    c.setUpperBound(30);
+    for (index e = 0; e < n; e += 3)
+        for (count i = Aux::Random::integer(4); i > 0; --i)
+            c.addToSubset(Aux::Random::integer(29), e);
+
+    const CompactCover cc(c);
+    EXPECT_EQ(cc.numberOfElements(), c.numberOfElements());
+    EXPECT_EQ(cc.upperBound(), c.upperBound());
+    EXPECT_EQ(cc.numberOfSubsets(), c.numberOfSubsets());
+    EXPECT_EQ(cc.subsetSizeMap(), c.subsetSizeMap());
+
+    for (index e = 0; e < n; ++e) {
+        const auto subsets = c.subsetsOf(e);
+        EXPECT_EQ(cc.contains(e), c.contains(e));
+        EXPECT_EQ(cc.subsetsOf(e), std::vector<index>(subsets.begin(), subsets.end()));
+        EXPECT_EQ(cc.numberOfSubsetsOf(e), subsets.size());
+        for (index s = 0; s < c.upperBound(); ++s)
+            EXPECT_EQ(cc.isInSubset(e, s), subsets.count(s) > 0);
+        if (!c.contains(e))
+            continue;
+        for (index f = 0; f < n; f += 7) {
+            if (c.contains(f)) {
+                EXPECT_EQ(cc.inSameSubset(e, f), c.inSameSubset(e, f));
+            }
+        }
+    }
+
+    for (index s = 0; s < c.upperBound(); ++s) {
+        const auto members = c.getMembers(s);
+        EXPECT_EQ(cc.getMembers(s), std::vector<index>(members.begin(), members.end()));
+    }
+
+    const Cover back = cc.toCover();
+    EXPECT_EQ(back.upperBound(), c.upperBound());
+    for (index e = 0; e < n; ++e)
+        EXPECT_EQ(back[e], c[e]);
+}
+
+TEST_F(CoverGTest, testCompactCoverBuilder) {
+    constexpr count n = 1000;
+    CompactCoverBuilder builder(n);
+#pragma omp parallel for
+    for (omp_index e = 0; e < static_cast<omp_index>(n); ++e) {
+        // element e is contained in the subsets e % 10 and e % 7 + 10, some twice
+        builder.addToSubset(e % 7 + 10, e);
+        builder.addToSubset(e % 10, e);
+        if (e % 3 == 0)
+            builder.addToSubset(e % 10, e);
+    }
+
+    const CompactCover cc = builder.build();
+    EXPECT_EQ(cc.numberOfElements(), n);
+    EXPECT_EQ(cc.numberOfMemberships(), 2 * n);
+    EXPECT_EQ(cc.upperBound(), 17);
+    EXPECT_EQ(cc.numberOfSubsets(), 17);
+
+    for (index e = 0; e < n; ++e) {
+        EXPECT_EQ(cc.subsetsOf(e), std::vector<index>({e % 10, e % 7 + 10}));
+        const index f = (e + 70) % n;
+        EXPECT_EQ(cc.numberOfCommonSubsets(e, f),
+                  static_cast<count>(e % 10 == f % 10) + static_cast<count>(e % 7 == f % 7));
+    }
+    EXPECT_TRUE(cc.inSameSubset(3, 13));
+    EXPECT_FALSE(cc.inSameSubset(3, 4));
+    EXPECT_EQ(cc.subsetSizes()[3], n / 10);
+
+    count entries = 0;
+    cc.forEntries([&](index e, index s) {
+        EXPECT_TRUE(cc.isInSubset(e, s));
+        ++entries;
+    });
+    EXPECT_EQ(entries, 2 * n);
+}
+
+TEST_F(CoverGTest, testCompactCoverBuilderNestedAndResized) {
+    constexpr count n = 100;
+    const int maxThreads = omp_get_max_threads();
+    CompactCoverBuilder builder(n);
+
+    // more threads than at construction, and nested parallel regions
+    omp_set_num_threads(maxThreads + 3);
+    omp_set_max_active_levels(2);
+#pragma omp parallel for num_threads(4)
+    for (omp_index s = 0; s < 4; ++s) {
+#pragma omp parallel for num_threads(3)
+        for (omp_index e = 0; e < static_cast<omp_index>(n); ++e)
+            builder.addToSubset(static_cast<index>(s), static_cast<index>(e));
+    }
+    omp_set_max_active_levels(1);
+    omp_set_num_threads(maxThreads);
+
+    CompactCover cc = builder.build();
+    EXPECT_EQ(cc.numberOfMemberships(), 4 * n);
+    for (index e = 0; e < n; ++e)
+        EXPECT_EQ(cc.subsetsOf(e), std::vector<index>({0, 1, 2, 3}));
+
+    // the builder is empty after build()
+    builder.addToSubset(5, 7);
+    cc = builder.build();
+    EXPECT_EQ(cc.numberOfMemberships(), 1);
+    EXPECT_TRUE(cc.isInSubset(7, 5));
+}
+
+TEST_F(CoverGTest, testCompactCoverFromPartition) {
+    Partition p(5);
+    p.setUpperBound(3);
+    p[0] = 0;
+    p[1] = 2;
+    p[2] = 2;
+    p[3] = none;
+    p[4] = 1;
+
+    const CompactCover cc(p);
+    EXPECT_EQ(cc.upperBound(), 3);
+    EXPECT_FALSE(cc.contains(3));
+    EXPECT_TRUE(cc.inSameSubset(1, 2));
+    EXPECT_FALSE(cc.inSameSubset(0, 4));
+    EXPECT_EQ(cc.getMembers(2), std::vector<index>({1, 2}));
+}
+
 } /* namespace NetworKit */
@@ -150,10 +150,12 @@ void MaxentStress::run() {
             // correcting rhs to be zero-sum
             Point<double> sum(oldCoordinates.size());
             for (index d = 0; d < dim; ++d) {
-                for (index i = 0; i < G->numberOfNodes(); ++i) {
-                    sum[d] += rhs[d][i];
+                double sumOfDimension = 0;
+#pragma omp parallel for reduction(+ : sumOfDimension)
+                for (omp_index i = 0; i < static_cast<omp_index>(G->numberOfNodes()); ++i) {
+                    sumOfDimension += rhs[d][i];
                 }
-                sum[d] /= G->numberOfNodes();
+                sum[d] = sumOfDimension / G->numberOfNodes();
             }
 
 #pragma omp parallel for
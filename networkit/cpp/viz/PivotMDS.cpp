@@ -26,32 +26,66 @@ void PivotMDS::run() {
     }
     std::vector<node> pivots = GraphTools::randomNodes(*G, numPivots);
 
-    std::vector<Triplet> triplets;
-    for (index j = 0; j < numPivots; ++j) { // compute distances from pivots to other nodes
-        Aux::PrioQueue<edgeweight, node> PQ(n);
-        std::vector<edgeweight> dist(n, std::numeric_limits<edgeweight>::max());
-
-        dist[pivots[j]] = 0;
-        PQ.insert(0, pivots[j]);
-        while (!PQ.empty()) {
-            node v = PQ.extractMin().second;
-            triplets.push_back({v, j, dist[v]});
-            G->forNeighborsOf(v, [&](node w, edgeweight weight) {
-                if (dist[v] + weight < dist[w]) {
-                    dist[w] = dist[v] + weight;
-                    PQ.changeKey(dist[w], w);
+    // compute distances from pivots to other nodes, one pivot per thread at a time
+    const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+    std::vector<std::vector<Triplet>> pivotTriplets(numPivots);
+    std::vector<double> colMean(numPivots, 0.0);
+#pragma omp parallel
+    {
+        std::vector<edgeweight> dist(n, infDist);
+        Aux::PrioQueue<edgeweight, node> PQ(G->isWeighted() ? n : 0);
+        std::vector<node> queue;
+
+#pragma omp for schedule(dynamic)
+        for (omp_index j = 0; j < static_cast<omp_index>(numPivots); ++j) {
+            std::vector<Triplet> &triplets = pivotTriplets[j];
+            triplets.reserve(n);
+            dist[pivots[j]] = 0;
+
+            if (G->isWeighted()) {
+                PQ.insert(0, pivots[j]);
+                while (!PQ.empty()) {
+                    node v = PQ.extractMin().second;
+                    triplets.push_back({v, static_cast<index>(j), dist[v]});
+                    G->forNeighborsOf(v, [&](node w, edgeweight weight) {
+                        if (dist[v] + weight < dist[w]) {
+                            dist[w] = dist[v] + weight;
+                            PQ.changeKey(dist[w], w);
+                        }
+                    });
+                }
+            } else { // BFS suffices on unweighted graphs
+                queue.assign(1, pivots[j]);
+                for (index i = 0; i < queue.size(); ++i) {
+                    node v = queue[i];
+                    triplets.push_back({v, static_cast<index>(j), dist[v]});
+                    G->forNeighborsOf(v, [&](node w) {
+                        if (dist[w] == infDist) {
+                            dist[w] = dist[v] + 1;
+                            queue.push_back(w);
+                        }
+                    });
                 }
-            });
+            }
+
+            for (const Triplet &triplet : triplets) {
+                colMean[j] += triplet.value / (double)n;
+                dist[triplet.row] = infDist;
+            }
         }
     }
 
+    std::vector<Triplet> triplets;
+    triplets.reserve(n * numPivots);
+    for (std::vector<Triplet> &tripletsOfPivot : pivotTriplets) {
+        triplets.insert(triplets.end(), tripletsOfPivot.begin(), tripletsOfPivot.end());
+        std::vector<Triplet>().swap(tripletsOfPivot);
+    }
+
     // double center the squared distance matrix
     std::vector<double> rowMean(n, 0.0);
-    std::vector<double> colMean(numPivots, 0.0);
-
-    for (Triplet &triplet : triplets) {
+    for (const Triplet &triplet : triplets) {
         rowMean[triplet.row] += triplet.value / (double)numPivots;
-        colMean[triplet.column] += triplet.value / (double)n;
     }
 
     double grandMean = 0.0;
@@ -65,7 +99,9 @@ void PivotMDS::run() {
         grandMean += colMean[j] * colDivisor;
     }
 
-    for (Triplet &triplet : triplets) {
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(triplets.size()); ++i) {
+        Triplet &triplet = triplets[i];
         triplet.value = triplet.value - rowMean[triplet.row] - colMean[triplet.column] + grandMean;
     }
 
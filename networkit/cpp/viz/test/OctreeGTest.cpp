@@ -81,4 +81,28 @@ TEST(OctreeGTest, testOctreeWithExample) {
         ocTree.approximateDistance(Point<double>(2.0, 22.0), 0.0);
     EXPECT_EQ(exactApprox.size(), 10u);
 }
+
+TEST(OctreeGTest, testOctreeWithManyPoints) {
+    Aux::Random::setSeed(42, false);
+    const count n = 100000;
+    for (count dim : {2, 3}) {
+        std::vector<Vector> coordinates(dim, Vector(n));
+        for (index d = 0; d < dim; ++d)
+            for (index i = 0; i < n; ++i)
+                coordinates[d][i] = Aux::Random::real(-100, 100);
+
+        Octree<double> ocTree(coordinates);
+        for (double theta : {0.0, 0.5, 1.0}) {
+            Point<double> queryPoint(dim);
+            for (index d = 0; d < dim; ++d)
+                queryPoint[d] = Aux::Random::real(-100, 100);
+
+            count sum = 0;
+            for (const auto &point : ocTree.approximateDistance(queryPoint, theta))
+                sum += point.first;
+            EXPECT_EQ(sum, n);
+        }
+    }
+}
+
 } /* namespace NetworKit */
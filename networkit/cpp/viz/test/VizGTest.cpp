@@ -15,6 +15,8 @@
 #include <networkit/graph/Graph.hpp>
 #include <networkit/io/DibapGraphReader.hpp>
 #include <networkit/io/PartitionWriter.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/viz/PivotMDS.hpp>
 #include <networkit/viz/PostscriptWriter.hpp>
 
 namespace NetworKit {
@@ -69,6 +71,30 @@ TEST_F(VizGTest, testPostscriptWriterOnRealGraph) {
     }
     EXPECT_TRUE(exists) << "A file should have been created : " << path;
 }
+
+TEST_F(VizGTest, testPivotMDSUnitWeights) {
+    // Distances from the pivots are computed by BFS on unweighted and by Dijkstra on weighted
+    // graphs; both must yield the same layout.
+    DibapGraphReader reader;
+    const Graph G = reader.read("input/airfoil1.gi");
+    const Graph weighted = GraphTools::toWeighted(G);
+
+    Aux::Random::setSeed(42, false);
+    PivotMDS pivotMds(G, 2, 30);
+    pivotMds.run();
+    const auto coordinates = pivotMds.getCoordinates();
+
+    Aux::Random::setSeed(42, false);
+    PivotMDS weightedPivotMds(weighted, 2, 30);
+    weightedPivotMds.run();
+    const auto weightedCoordinates = weightedPivotMds.getCoordinates();
+
+    G.forNodes([&](node u) {
+        for (index d = 0; d < 2; ++d)
+            EXPECT_NEAR(coordinates[u][d], weightedCoordinates[u][d], 1e-6);
+    });
+}
+
 #endif
 
 } /* namespace NetworKit */
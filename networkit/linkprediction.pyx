@@ -27,6 +27,7 @@ cdef extern from "<networkit/linkprediction/LinkPredictor.hpp>":
 		double run(node u, node v) except +
 		vector[pair[pair[node, node], double]] runAll() except +
 		vector[pair[pair[node, node], double]] runOn(vector[pair[node, node]] nodePairs) except +
+		vector[pair[pair[node, node], double]] runTopK(count k, count batchSize) except +
 		void setGraph(const _Graph& newGraph) except +
 
 cdef class LinkPredictor:
@@ -129,6 +130,30 @@ cdef class LinkPredictor:
 		"""
 		return move(self._this.runOn(nodePairs))
 
+	def runTopK(self, count k, count batchSize = 1 << 20):
+		"""
+		runTopK(k, batchSize=2**20)
+
+		Returns the k highest scored node-pairs (u, v) with u < v that are not connected but have
+		at least one common neighbor.
+
+		The candidates are enumerated in batches of at most batchSize wedges and scored by runOn,
+		so the memory usage does not grow quadratically with the number of nodes.
+
+		Parameters
+		----------
+		k : int
+			Number of node-pairs to return.
+		batchSize : int, optional
+			Upper bound on the number of wedges enumerated per batch. Default: 2**20
+
+		Returns
+		-------
+		list(tuple(tuple(int, int), float))
+			A list of at most k predictions, sorted descendingly by score.
+		"""
+		return move(self._this.runTopK(k, batchSize))
+
 cdef extern from "<networkit/linkprediction/KatzIndex.hpp>":
 
 	cdef cppclass _KatzIndex "NetworKit::KatzIndex"(_LinkPredictor):
@@ -16,6 +16,7 @@ cdef extern from "<networkit/randomization/EdgeSwitching.hpp>":
 		count getNumberOfAffectedEdges()
 		double getNumberOfSwitchesPerEdge()
 		void setNumberOfSwitchesPerEdge(double)
+		void setParallel(bool_t)
 
 	cdef cppclass _EdgeSwitchingInPlace "NetworKit::EdgeSwitchingInPlace"(_Algorithm):
 		_EdgeSwitchingInPlace(_Graph, double) except +
@@ -23,6 +24,7 @@ cdef extern from "<networkit/randomization/EdgeSwitching.hpp>":
 		count getNumberOfAffectedEdges()
 		double getNumberOfSwitchesPerEdge()
 		void setNumberOfSwitchesPerEdge(double)
+		void setParallel(bool_t)
 
 
 cdef class EdgeSwitching(Algorithm):
@@ -82,6 +84,20 @@ cdef class EdgeSwitching(Algorithm):
 	def setNumberOfSwitchesPerEdge(self, numberOfSwitchesPerEdge):
 		(<_EdgeSwitching*>(self._this)).setNumberOfSwitchesPerEdge(numberOfSwitchesPerEdge)
 
+	def setParallel(self, parallel):
+		"""
+		setParallel(parallel)
+
+		If set to False, the switches are carried out by a single thread, so that the result
+		only depends on the seed set with networkit.engineering.setSeed. Default: True
+
+		Parameters
+		----------
+		parallel : bool
+			Whether to run in parallel.
+		"""
+		(<_EdgeSwitching*>(self._this)).setParallel(parallel)
+
 cdef class EdgeSwitchingInPlace(Algorithm):
 	"""
 	EdgeSwitchingInPlace(G, numberOfSwitchesPerEdge)
@@ -165,6 +181,20 @@ cdef class EdgeSwitchingInPlace(Algorithm):
 	def setNumberOfSwitchesPerEdge(self, numberOfSwitchesPerEdge):
 		(<_EdgeSwitchingInPlace*>(self._this)).setNumberOfSwitchesPerEdge(numberOfSwitchesPerEdge)
 
+	def setParallel(self, parallel):
+		"""
+		setParallel(parallel)
+
+		If set to False, the switches are carried out by a single thread, so that the result
+		only depends on the seed set with networkit.engineering.setSeed. Default: True
+
+		Parameters
+		----------
+		parallel : bool
+			Whether to run in parallel.
+		"""
+		(<_EdgeSwitchingInPlace*>(self._this)).setParallel(parallel)
+
 
 cdef extern from "<networkit/randomization/GlobalCurveball.hpp>":
 
@@ -325,6 +355,7 @@ cdef extern from "<networkit/randomization/Curveball.hpp>":
 		_Graph getGraph() except +
 		vector[pair[node, node]] getEdges() except +
 		count getNumberOfAffectedEdges() except +
+		void setParallel(bool_t) except +
 
 cdef class Curveball(Algorithm):
 	"""
@@ -351,6 +382,11 @@ cdef class Curveball(Algorithm):
 	footprint which increases linearly with the number of trades
 	performed in a run.
 
+	Consecutive trades whose nodes are distinct and not adjacent are
+	carried out in parallel; the result is distributed as if the trades
+	had been carried out one after another. The parallel execution is
+	not reproducible from a seed, see setParallel().
+
 	Parameters
 	----------
 	G : networkit.Graph
@@ -378,6 +414,20 @@ cdef class Curveball(Algorithm):
 			(<_Curveball*>(self._this)).run(trades)
 		return self
 
+	def setParallel(self, parallel):
+		"""
+		setParallel(parallel)
+
+		If set to False, the trades are carried out by a single thread, so that the result
+		only depends on the seed set with networkit.engineering.setSeed. Default: True
+
+		Parameters
+		----------
+		parallel : bool
+			Whether to run in parallel.
+		"""
+		(<_Curveball*>(self._this)).setParallel(parallel)
+
 	def getGraph(self):
 		"""
 		getGraph()